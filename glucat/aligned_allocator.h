@@ -0,0 +1,100 @@
+#ifndef _GLUCAT_ALIGNED_ALLOCATOR_H
+#define _GLUCAT_ALIGNED_ALLOCATOR_H
+/***************************************************************************
+    GluCat : Generic library of universal Clifford algebra templates
+    aligned_allocator.h : Allocator of cache line aligned arrays
+                             -------------------
+    begin                : Sun 2026-10-18
+    copyright            : (C) 2001-2016 by Paul C. Leopardi
+ ***************************************************************************
+
+    This library is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published
+    by the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with this library.  If not, see <http://www.gnu.org/licenses/>.
+
+ ***************************************************************************
+ This library is based on a prototype written by Arvind Raja and was
+ licensed under the LGPL with permission of the author. See Arvind Raja,
+ "Object-oriented implementations of Clifford algebras in C++: a prototype",
+ in Ablamowicz, Lounesto and Parra (eds.)
+ "Clifford algebras with numeric and symbolic computations, Birkhauser, 1996."
+ ***************************************************************************
+ See also Arvind Raja's original header comments and references in glucat.h
+ ***************************************************************************/
+
+#include <cstddef>
+#include <new>
+
+namespace glucat
+{
+  /// Stateless allocator whose arrays start on a boundary of Alignment bytes.
+  // Alignment must be a power of 2, no smaller than the alignment of void*.
+  // Each block is obtained from operator new, with room for the padding and for a
+  // pointer to the start of the block, which is kept just below the aligned array.
+  template< typename T, std::size_t Alignment = 64 >
+  class aligned_allocator
+  {
+  public:
+    typedef T                                          value_type;
+    typedef T*                                         pointer;
+    typedef const T*                                   const_pointer;
+    typedef T&                                         reference;
+    typedef const T&                                   const_reference;
+    typedef std::size_t                                size_type;
+    typedef std::ptrdiff_t                             difference_type;
+    template< typename U >
+    struct rebind
+    { typedef aligned_allocator<U, Alignment> other; };
+
+    aligned_allocator()
+    { }
+    template< typename U >
+    aligned_allocator(const aligned_allocator<U, Alignment>&)
+    { }
+
+    pointer       address(reference x) const
+    { return &x; }
+    const_pointer address(const_reference x) const
+    { return &x; }
+    size_type     max_size() const
+    { return (size_type(-1) - Alignment - sizeof(void*)) / sizeof(T); }
+
+    pointer allocate(const size_type n, const void* = 0)
+    {
+      if (n > max_size())
+        throw std::bad_alloc();
+      char* block = static_cast<char*>(::operator new(n * sizeof(T) + Alignment + sizeof(void*)));
+      const std::size_t addr = reinterpret_cast<std::size_t>(block + sizeof(void*));
+      char* result = block + sizeof(void*) + ((Alignment - addr % Alignment) % Alignment);
+      reinterpret_cast<void**>(result)[-1] = block;
+      return reinterpret_cast<pointer>(result);
+    }
+    void    deallocate(pointer p, const size_type)
+    {
+      if (p != 0)
+        ::operator delete(reinterpret_cast<void**>(p)[-1]);
+    }
+
+    void construct(pointer p, const T& val)
+    { ::new(static_cast<void*>(p)) T(val); }
+    void destroy(pointer p)
+    { p->~T(); }
+
+    template< typename U >
+    bool operator== (const aligned_allocator<U, Alignment>&) const
+    { return true; }
+    template< typename U >
+    bool operator!= (const aligned_allocator<U, Alignment>&) const
+    { return false; }
+  };
+}
+#endif  // _GLUCAT_ALIGNED_ALLOCATOR_H
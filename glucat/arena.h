@@ -0,0 +1,166 @@
+#ifndef _GLUCAT_ARENA_H
+#define _GLUCAT_ARENA_H
+/***************************************************************************
+    GluCat : Generic library of universal Clifford algebra templates
+    arena.h : Scoped per-thread arena allocator
+                             -------------------
+    begin                : Sat 2026-10-17
+    copyright            : (C) 2001-2016 by Paul C. Leopardi
+ ***************************************************************************
+
+    This library is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published
+    by the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with this library.  If not, see <http://www.gnu.org/licenses/>.
+
+ ***************************************************************************
+ This library is based on a prototype written by Arvind Raja and was
+ licensed under the LGPL with permission of the author. See Arvind Raja,
+ "Object-oriented implementations of Clifford algebras in C++: a prototype",
+ in Ablamowicz, Lounesto and Parra (eds.)
+ "Clifford algebras with numeric and symbolic computations, Birkhauser, 1996."
+ ***************************************************************************
+ See also Arvind Raja's original header comments and references in glucat.h
+ ***************************************************************************/
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+namespace glucat
+{
+  /// Scope within which containers using arena_allocator<> allocate from a bump arena.
+  // Usage:
+  //   {
+  //     arena_scope scope;
+  //     ... compute with framed_multi<> temporaries ...
+  //     result = value; // result was constructed outside the scope
+  //   }
+  // Each scope owns its own blocks, which are freed in one step when the scope ends.
+  // Deallocation within the scope does nothing.
+  // The current scope is per thread, and scopes nest: the innermost scope is current.
+  // A copy of a container is allocated from the scope that is current when the copy
+  // is made, so copying or assigning a value to an object which outlives the scope is safe.
+  // An object constructed within the scope, including one initialized from a
+  // value returned by a function, must not outlive the scope.
+  class arena_scope
+  {
+  public:
+    /// Enter a new scope
+    arena_scope()
+    : m_offset(block_size), m_prev(current())
+    { current() = this; }
+    /// Leave the scope and free all of its blocks
+    ~arena_scope()
+    {
+      current() = m_prev;
+      for (std::vector<char*>::iterator
+          block_it = m_blocks.begin();
+          block_it != m_blocks.end();
+          ++block_it)
+        ::operator delete(*block_it);
+    }
+    /// Innermost scope for this thread, or 0 if there is none
+    static arena_scope*& current()
+    {
+      static thread_local arena_scope* current_scope = 0;
+      return current_scope;
+    }
+    /// Allocate n bytes by bumping a pointer into the current block
+    void* allocate(std::size_t n)
+    {
+      n = (n + alignment - 1) & ~(alignment - 1);
+      if (n > block_size / 4)
+      { // Large requests get their own block, leaving the current block in use
+        char* large_block = static_cast<char*>(::operator new(n));
+        m_blocks.insert(m_blocks.end() - (m_blocks.empty() ? 0 : 1), large_block);
+        return large_block;
+      }
+      if (m_offset + n > block_size)
+      {
+        m_blocks.push_back(static_cast<char*>(::operator new(block_size)));
+        m_offset = 0;
+      }
+      void* result = m_blocks.back() + m_offset;
+      m_offset += n;
+      return result;
+    }
+  private:
+    // Enforce scoped use
+    arena_scope(const arena_scope&);
+    arena_scope& operator= (const arena_scope&);
+    static void* operator new(std::size_t);
+
+    static const std::size_t block_size = std::size_t(1) << 16;
+    static const std::size_t alignment  = alignof(std::max_align_t);
+
+    /// Blocks owned by this scope: the last block is the current block
+    std::vector<char*> m_blocks;
+    /// Number of bytes used in the current block
+    std::size_t        m_offset;
+    /// Scope which was current when this scope was entered
+    arena_scope*       m_prev;
+  };
+
+  /// Allocator which uses the arena_scope current at construction, or else operator new
+  template< typename T >
+  class arena_allocator
+  {
+  public:
+    typedef T                                          value_type;
+    // An allocator never moves to another container, because a container which outlives
+    // the scope must not take on the allocator of the scope. Containers whose allocators
+    // are unequal must therefore not be swapped: framed_multi<>::take_value() copies instead.
+    typedef std::false_type                            propagate_on_container_copy_assignment;
+    typedef std::false_type                            propagate_on_container_move_assignment;
+    typedef std::false_type                            propagate_on_container_swap;
+
+    /// Default constructor: use the current scope, if any
+    arena_allocator()
+    : m_scope(arena_scope::current())
+    { }
+    /// Construct an allocator for T which uses the same scope as an allocator for U
+    template< typename U >
+    arena_allocator(const arena_allocator<U>& other)
+    : m_scope(other.m_scope)
+    { }
+
+    T*   allocate(const std::size_t n)
+    {
+      const std::size_t nbr_bytes = n * sizeof(T);
+      return static_cast<T*>(m_scope ? m_scope->allocate(nbr_bytes) : ::operator new(nbr_bytes));
+    }
+    void deallocate(T* p, const std::size_t)
+    {
+      if (!m_scope)
+        ::operator delete(p);
+    }
+
+    /// A copy of a container uses the scope current when the copy is made
+    arena_allocator select_on_container_copy_construction() const
+    { return arena_allocator(); }
+
+    template< typename U >
+    bool operator== (const arena_allocator<U>& rhs) const
+    { return m_scope == rhs.m_scope; }
+    template< typename U >
+    bool operator!= (const arena_allocator<U>& rhs) const
+    { return m_scope != rhs.m_scope; }
+
+  private:
+    template< typename U >
+    friend class arena_allocator;
+    /// Scope to allocate from, or 0 to use operator new
+    arena_scope* m_scope;
+  };
+}
+#endif  // _GLUCAT_ARENA_H
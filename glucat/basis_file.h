@@ -0,0 +1,122 @@
+#ifndef _GLUCAT_BASIS_FILE_H
+#define _GLUCAT_BASIS_FILE_H
+/***************************************************************************
+    GluCat : Generic library of universal Clifford algebra templates
+    basis_file.h : Declare a memory mapped file of generators and basis elements
+                             -------------------
+    begin                : Sat 2026-10-17
+    copyright            : (C) 2001-2016 by Paul C. Leopardi
+ ***************************************************************************
+
+    This library is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published
+    by the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with this library.  If not, see <http://www.gnu.org/licenses/>.
+
+ ***************************************************************************
+ This library is based on a prototype written by Arvind Raja and was
+ licensed under the LGPL with permission of the author. See Arvind Raja,
+ "Object-oriented implementations of Clifford algebras in C++: a prototype",
+ in Ablamowicz, Lounesto and Parra (eds.)
+ "Clifford algebras with numeric and symbolic computations, Birkhauser, 1996."
+ ***************************************************************************
+ See also Arvind Raja's original header comments and references in glucat.h
+ ***************************************************************************/
+
+#include "glucat/errors.h"
+#include "glucat/matrix.h"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace glucat
+{
+  /// Name of the environment variable which names the basis file to open at startup
+  const char BASIS_FILE_ENV_NAME[] = "GLUCAT_BASIS_FILE";
+
+  /// Read only, memory mapped file of generators and folded basis elements
+  // The file holds, for each signature p,q with p+q <= max_count, the generators
+  // used by matrix_multi<>, and optionally all of its folded basis elements, each
+  // as a signed permutation matrix. The file is mapped read only, so that its pages
+  // are shared, through the page cache, by all processes which use the same file.
+  // The file is opened when first used, if the environment variable GLUCAT_BASIS_FILE
+  // names it, or by open(). It must not be opened or closed while it is in use.
+  // The file is in the native byte order and is not portable between architectures.
+  class basis_file
+  {
+  public:
+    typedef basis_file                        basis_file_t;
+    typedef error<basis_file_t>               error_t;
+    typedef matrix::signed_perm               signed_perm_t;
+    typedef signed_perm_t::size_type          word_t;
+
+    /// Class name used in messages
+    static const std::string classname();
+    /// Single instance of basis file
+    static basis_file& file();
+
+    /// Map the named file, replacing any file already mapped; return false on failure
+    bool  open(const std::string& file_name);
+    /// Unmap the file
+    void  close();
+    /// Is a file mapped?
+    bool  is_open() const;
+    /// Largest p+q of the signatures held by the file
+    index_t max_count() const;
+
+    /// Copy the generators for signature p,q into result: generator k, for -q <= k <= p, is result[q + k]
+    bool  generators(const index_t p, const index_t q, std::vector<signed_perm_t>& result) const;
+    /// Copy the folded basis element for signature p,q with the given value of fold into result
+    bool  basis_element(const index_t p, const index_t q, const set_value_t folded_value, signed_perm_t& result) const;
+
+    /// Write a basis file for all signatures p,q with p+q <= max_count
+    // Basis elements are written for signatures with p+q <= max_basis_count.
+    // The file is written under a temporary name and then renamed, so that
+    // processes which map the file never see it partly written.
+    template< typename Matrix_T >
+    static void write(const std::string& file_name,
+                      const index_t max_count,
+                      const index_t max_basis_count);
+  private:
+    /// Words per entry of the table of signatures: p, q, dim, nbr_basis, gens_offset, basis_offset
+    static const std::size_t entry_words = 6;
+    /// Words in the header: magic (2 words), version, max_count
+    static const std::size_t header_words = 4;
+
+    /// Position of the entry for signature p,q within the table of signatures
+    static std::size_t entry_index(const index_t p, const index_t q);
+    /// Entry for signature p,q, or 0 if the file does not hold it
+    const word_t* entry(const index_t p, const index_t q) const;
+    /// Check the header and the table of signatures of the mapped file
+    bool  is_valid() const;
+    /// Check that each of nbr_rows packed rows has a column less than dim
+    static bool rows_are_valid(const word_t* rows, const std::size_t nbr_rows, const word_t dim);
+
+    // Enforce singleton
+    // Reference: A. Alexandrescu, "Modern C++ Design", Chapter 6
+    basis_file();
+    ~basis_file();
+    basis_file(const basis_file&);
+    basis_file& operator= (const basis_file&);
+
+    /// Start of the mapping
+    const word_t* m_words;
+    /// Number of words mapped
+    std::size_t   m_nbr_words;
+
+    /// Friend declaration to avoid compiler warning:
+    /// "... only defines a private destructor and has no friends"
+    /// Ref: Carlos O'Ryan, ACE http://doc.ece.uci.edu
+    friend class friend_for_private_destructor;
+  };
+}
+#endif  // _GLUCAT_BASIS_FILE_H
@@ -0,0 +1,368 @@
+#ifndef _GLUCAT_BASIS_FILE_IMP_H
+#define _GLUCAT_BASIS_FILE_IMP_H
+/***************************************************************************
+    GluCat : Generic library of universal Clifford algebra templates
+    basis_file_imp.h : Implement a memory mapped file of generators and basis elements
+                             -------------------
+    begin                : Sat 2026-10-17
+    copyright            : (C) 2001-2016 by Paul C. Leopardi
+ ***************************************************************************
+
+    This library is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published
+    by the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with this library.  If not, see <http://www.gnu.org/licenses/>.
+
+ ***************************************************************************
+ This library is based on a prototype written by Arvind Raja and was
+ licensed under the LGPL with permission of the author. See Arvind Raja,
+ "Object-oriented implementations of Clifford algebras in C++: a prototype",
+ in Ablamowicz, Lounesto and Parra (eds.)
+ "Clifford algebras with numeric and symbolic computations, Birkhauser, 1996."
+ ***************************************************************************
+ See also Arvind Raja's original header comments and references in glucat.h
+ ***************************************************************************/
+
+#include "glucat/basis_file.h"
+#include "glucat/generation.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <limits>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace glucat
+{
+  // The file is an array of words. It starts with a header:
+  //   magic (2 words), version, max_count,
+  // followed by a table with an entry for each signature p,q with p+q <= max_count,
+  // in order of p+q then q, each entry being:
+  //   p, q, dim, nbr_basis, gens_offset, basis_offset,
+  // followed by the generators and basis elements, each as dim packed rows.
+  // Offsets are in words from the start of the file. The generators for p,q are
+  // the p+q+1 signed permutations at gens_offset, for -q <= k <= p. The folded basis
+  // element with value of fold v is the signed permutation at basis_offset + v*dim.
+  // nbr_basis is either 0, if no basis elements are held for p,q, or 2^(p+q).
+
+  /// Magic words and version of the file format
+  const basis_file::word_t basis_file_magic[] = { 0x43554c47, 0x46426154 };
+  const basis_file::word_t basis_file_version = 1;
+
+  // Defined in matrix_multi_imp.h
+  inline index_t offset_level(const index_t p, const index_t q);
+
+  /// Class name used in messages
+  inline
+  const std::string
+  basis_file::
+  classname()
+  { return "basis_file"; }
+
+  /// Single instance of basis file
+  inline
+  basis_file&
+  basis_file::
+  file()
+  { static basis_file f; return f; }
+
+  /// Open the file named by the environment variable, if any
+  inline
+  basis_file::
+  basis_file()
+  : m_words(0), m_nbr_words(0)
+  {
+    const char* file_name = std::getenv(BASIS_FILE_ENV_NAME);
+    if (file_name != 0 && *file_name != '\0')
+      this->open(file_name);
+  }
+
+  inline
+  basis_file::
+  ~basis_file()
+  { this->close(); }
+
+  /// Map the named file, replacing any file already mapped; return false on failure
+  inline
+  bool
+  basis_file::
+  open(const std::string& file_name)
+  {
+    this->close();
+    const int fd = ::open(file_name.c_str(), O_RDONLY);
+    if (fd < 0)
+      return false;
+    struct stat file_stat;
+    if (::fstat(fd, &file_stat) != 0
+     || file_stat.st_size < off_t(header_words * sizeof(word_t))
+     || file_stat.st_size % off_t(sizeof(word_t)) != 0)
+    {
+      ::close(fd);
+      return false;
+    }
+    const std::size_t nbr_bytes = std::size_t(file_stat.st_size);
+    void* addr = ::mmap(0, nbr_bytes, PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (addr == MAP_FAILED)
+      return false;
+    this->m_words = static_cast<const word_t*>(addr);
+    this->m_nbr_words = nbr_bytes / sizeof(word_t);
+    if (!this->is_valid())
+    {
+      this->close();
+      return false;
+    }
+    return true;
+  }
+
+  /// Unmap the file
+  inline
+  void
+  basis_file::
+  close()
+  {
+    if (this->m_words != 0)
+      ::munmap(const_cast<word_t*>(this->m_words), this->m_nbr_words * sizeof(word_t));
+    this->m_words = 0;
+    this->m_nbr_words = 0;
+  }
+
+  /// Is a file mapped?
+  inline
+  bool
+  basis_file::
+  is_open() const
+  { return this->m_words != 0; }
+
+  /// Largest p+q of the signatures held by the file
+  inline
+  index_t
+  basis_file::
+  max_count() const
+  { return this->is_open() ? index_t(this->m_words[3]) : index_t(-1); }
+
+  /// Position of the entry for signature p,q within the table of signatures
+  inline
+  std::size_t
+  basis_file::
+  entry_index(const index_t p, const index_t q)
+  {
+    const std::size_t count = std::size_t(p + q);
+    return count * (count + 1) / 2 + std::size_t(q);
+  }
+
+  /// Entry for signature p,q, or 0 if the file does not hold it
+  inline
+  const basis_file::word_t*
+  basis_file::
+  entry(const index_t p, const index_t q) const
+  {
+    if (p < 0 || q < 0 || p + q > this->max_count())
+      return 0;
+    return this->m_words + header_words + entry_index(p, q) * entry_words;
+  }
+
+  /// Check the header and the table of signatures of the mapped file
+  // The rows themselves are not checked, so that checking does not touch every page:
+  // the rows of an entry are checked by rows_are_valid() each time they are copied.
+  inline
+  bool
+  basis_file::
+  is_valid() const
+  {
+    const word_t* words = this->m_words;
+    if (words[0] != basis_file_magic[0]
+     || words[1] != basis_file_magic[1]
+     || words[2] != basis_file_version
+     || words[3] >= word_t(std::numeric_limits<set_value_t>::digits))
+      return false;
+    const index_t max_count = index_t(words[3]);
+    const std::size_t nbr_words = this->m_nbr_words;
+    if (header_words + entry_index(max_count + 1, 0) * entry_words > nbr_words)
+      return false;
+    for (index_t
+        count = 0;
+        count <= max_count;
+        ++count)
+      for (index_t
+          q = 0;
+          q <= count;
+          ++q)
+      {
+        const index_t p = count - q;
+        const word_t* e = this->entry(p, q);
+        const std::size_t dim = e[2];
+        const std::size_t nbr_basis = e[3];
+        if (e[0] != word_t(p) || e[1] != word_t(q)
+         || dim != (std::size_t(1) << offset_level(p, q))
+         || (nbr_basis != 0 && nbr_basis != (std::size_t(1) << count))
+         || e[4] > nbr_words || (nbr_words - e[4]) / dim < std::size_t(count + 1)
+         || e[5] > nbr_words || (nbr_words - e[5]) / dim < nbr_basis)
+          return false;
+      }
+    return true;
+  }
+
+  /// Check that each of nbr_rows packed rows has a column less than dim
+  inline
+  bool
+  basis_file::
+  rows_are_valid(const word_t* rows, const std::size_t nbr_rows, const word_t dim)
+  {
+    for (std::size_t
+        row = 0;
+        row != nbr_rows;
+        ++row)
+      if ((rows[row] & ~signed_perm_t::packed_sign_bit) >= dim)
+        return false;
+    return true;
+  }
+
+  /// Copy the generators for signature p,q into result: generator k, for -q <= k <= p, is result[q + k]
+  inline
+  bool
+  basis_file::
+  generators(const index_t p, const index_t q, std::vector<signed_perm_t>& result) const
+  {
+    const word_t* e = this->entry(p, q);
+    if (e == 0)
+      return false;
+    const word_t dim = e[2];
+    const word_t* gens = this->m_words + e[4];
+    if (!rows_are_valid(gens, std::size_t(p + q + 1) * dim, dim))
+      return false;
+    result.clear();
+    result.reserve(p + q + 1);
+    for (index_t
+        k = -q;
+        k <= p;
+        ++k)
+      result.push_back(signed_perm_t(dim, gens + std::size_t(q + k) * dim));
+    return true;
+  }
+
+  /// Copy the folded basis element for signature p,q with the given value of fold into result
+  inline
+  bool
+  basis_file::
+  basis_element(const index_t p, const index_t q, const set_value_t folded_value, signed_perm_t& result) const
+  {
+    const word_t* e = this->entry(p, q);
+    if (e == 0 || folded_value >= set_value_t(e[3]))
+      return false;
+    const word_t dim = e[2];
+    const word_t* rows = this->m_words + e[5] + std::size_t(folded_value) * dim;
+    if (!rows_are_valid(rows, dim, dim))
+      return false;
+    result = signed_perm_t(dim, rows);
+    return true;
+  }
+
+  /// Write a basis file for all signatures p,q with p+q <= max_count
+  template< typename Matrix_T >
+  void
+  basis_file::
+  write(const std::string& file_name,
+        const index_t max_count,
+        const index_t max_basis_count)
+  {
+    if (max_count < 0 || max_count >= index_t(std::numeric_limits<set_value_t>::digits))
+      throw error_t("write(file_name,max_count,max_basis_count): max_count out of range");
+
+    std::vector<word_t> words(header_words + entry_index(max_count + 1, 0) * entry_words, 0);
+    words[0] = basis_file_magic[0];
+    words[1] = basis_file_magic[1];
+    words[2] = basis_file_version;
+    words[3] = word_t(max_count);
+    for (index_t
+        count = 0;
+        count <= max_count;
+        ++count)
+      for (index_t
+          q = 0;
+          q <= count;
+          ++q)
+      {
+        const index_t p = count - q;
+        const std::vector<Matrix_T> e = (gen::generator_table<Matrix_T>::generator())(p, q);
+        std::vector<signed_perm_t> gens;
+        gens.reserve(e.size());
+        for (std::size_t
+            k = 0;
+            k != e.size();
+            ++k)
+          gens.push_back(signed_perm_t(e[k]));
+        const word_t dim = gens[0].size();
+        const bool with_basis = (count <= max_basis_count);
+        const std::size_t nbr_basis = with_basis ? (std::size_t(1) << count) : 0;
+        const std::size_t gens_offset = words.size();
+        const std::size_t basis_offset = gens_offset + gens.size() * dim;
+        if (basis_offset + nbr_basis * dim > std::size_t(std::numeric_limits<word_t>::max()))
+          throw error_t("write(file_name,max_count,max_basis_count): file too large");
+
+        std::size_t entry_offset = header_words + entry_index(p, q) * entry_words;
+        words[entry_offset++] = word_t(p);
+        words[entry_offset++] = word_t(q);
+        words[entry_offset++] = dim;
+        words[entry_offset++] = word_t(nbr_basis);
+        words[entry_offset++] = word_t(gens_offset);
+        words[entry_offset++] = word_t(basis_offset);
+
+        words.resize(basis_offset + nbr_basis * dim);
+        for (std::size_t
+            k = 0;
+            k != gens.size();
+            ++k)
+          gens[k].pack(&words[gens_offset + k * dim]);
+        if (with_basis)
+        {
+          // The folded basis element with value of fold v is the product of the generators
+          // for the bits of v, in increasing order, so it is the basis element for v
+          // without its highest bit, times the generator for that bit.
+          std::vector<signed_perm_t> basis(nbr_basis);
+          basis[0] = signed_perm_t(dim);
+          for (std::size_t
+              v = 1;
+              v != nbr_basis;
+              ++v)
+          {
+            index_t bit = 0;
+            while ((v >> (bit + 1)) != 0)
+              ++bit;
+            const index_t k = (bit < q) ? bit - q : bit - q + 1;
+            basis[v] = matrix::signed_perm_prod(basis[v ^ (std::size_t(1) << bit)], gens[q + k]);
+            basis[v].pack(&words[basis_offset + v * dim]);
+          }
+          basis[0].pack(&words[basis_offset]);
+        }
+      }
+
+    const std::string tmp_name = file_name + ".tmp";
+    std::ofstream out(tmp_name.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+    out.write(reinterpret_cast<const char*>(&words[0]), std::streamsize(words.size() * sizeof(word_t)));
+    out.close();
+    if (!out)
+    {
+      std::remove(tmp_name.c_str());
+      throw error_t("write(file_name,max_count,max_basis_count): cannot write " + tmp_name);
+    }
+    if (std::rename(tmp_name.c_str(), file_name.c_str()) != 0)
+    {
+      std::remove(tmp_name.c_str());
+      throw error_t("write(file_name,max_count,max_basis_count): cannot rename " + tmp_name);
+    }
+  }
+}
+#endif  // _GLUCAT_BASIS_FILE_IMP_H
@@ -0,0 +1,105 @@
+#ifndef _GLUCAT_BATCH_H
+#define _GLUCAT_BATCH_H
+/***************************************************************************
+    GluCat : Generic library of universal Clifford algebra templates
+    batch.h : Declare a class for geometric products of batches of multivectors
+                             -------------------
+    begin                : Sat 2026-10-17
+    copyright            : (C) 2001-2016 by Paul C. Leopardi
+ ***************************************************************************
+
+    This library is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published
+    by the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with this library.  If not, see <http://www.gnu.org/licenses/>.
+
+ ***************************************************************************
+ This library is based on a prototype written by Arvind Raja and was
+ licensed under the LGPL with permission of the author. See Arvind Raja,
+ "Object-oriented implementations of Clifford algebras in C++: a prototype",
+ in Ablamowicz, Lounesto and Parra (eds.)
+ "Clifford algebras with numeric and symbolic computations, Birkhauser, 1996."
+ ***************************************************************************
+ See also Arvind Raja's original header comments and references in glucat.h
+ ***************************************************************************/
+
+#include "glucat/global.h"
+#include "glucat/errors.h"
+#include "glucat/index_set.h"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace glucat
+{
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  class framed_multi; // forward
+
+  /// Geometric products of batches of multivectors which all lie within one frame.
+  // Usage:
+  //   const batch_product<double> table(frm);
+  //   table.multiply(lhs, rhs, result, batch_size);
+  // sets result[i] = lhs[i] * rhs[i] for each i from 0 to batch_size-1.
+  // Each batch is stored as a structure of arrays: coordinate k of multivector i
+  // is at position k * batch_size + i, where k is the value of the fold of the
+  // index set of the coordinate within the frame. pack() and unpack() convert
+  // between a framed_multi<> and its position within a batch.
+  // The table of signs of products of basis elements is built once, by the constructor,
+  // and holds 4^n entries for a frame of n indices, so it is intended for small frames.
+  // Within each block of the batch, the innermost loop runs along the batch,
+  // so that the compiler can use SIMD instructions.
+  template< typename Scalar_T = double, const index_t LO = DEFAULT_LO, const index_t HI = DEFAULT_HI >
+  class batch_product
+  {
+  public:
+    typedef batch_product                              batch_product_t;
+    typedef Scalar_T                                   scalar_t;
+    typedef index_set<LO,HI>                           index_set_t;
+    typedef framed_multi<Scalar_T,LO,HI>               framed_multi_t;
+    typedef error<batch_product_t>                     error_t;
+    typedef std::size_t                                size_type;
+
+    /// Class name used in messages
+    static const std::string classname();
+    /// Construct the table of products of basis elements for the given frame
+    batch_product(const index_set_t frm);
+
+    /// Frame of each multivector in a batch
+    const index_set_t frame() const;
+    /// Number of coordinates of each multivector in a batch
+    set_value_t       dim() const;
+
+    /// Geometric products of a batch: result[i] = lhs[i] * rhs[i]
+    // Each of lhs, rhs and result holds dim() * batch_size coordinates.
+    // result may be the same array as lhs or rhs.
+    void multiply(const Scalar_T* lhs, const Scalar_T* rhs, Scalar_T* result,
+                  const size_type batch_size) const;
+
+    /// Store val as multivector i of a batch
+    void pack(const framed_multi_t& val, Scalar_T* coords,
+              const size_type batch_size, const size_type i) const;
+    /// Multivector i of a batch
+    const framed_multi_t unpack(const Scalar_T* coords,
+                                const size_type batch_size, const size_type i) const;
+  private:
+    /// Number of coordinates of each multivector within a block of the batch
+    static const size_type block_coords = 4096;
+
+    /// Frame of each multivector in a batch
+    const index_set_t     m_frame;
+    /// Number of coordinates of each multivector
+    const set_value_t     m_dim;
+    /// Sign of the product of basis elements with values j and k is m_sign[j * m_dim + k]
+    std::vector<Scalar_T> m_sign;
+  };
+}
+#endif  // _GLUCAT_BATCH_H
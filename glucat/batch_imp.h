@@ -0,0 +1,189 @@
+#ifndef _GLUCAT_BATCH_IMP_H
+#define _GLUCAT_BATCH_IMP_H
+/***************************************************************************
+    GluCat : Generic library of universal Clifford algebra templates
+    batch_imp.h : Implement geometric products of batches of multivectors
+                             -------------------
+    begin                : Sat 2026-10-17
+    copyright            : (C) 2001-2016 by Paul C. Leopardi
+ ***************************************************************************
+
+    This library is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published
+    by the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with this library.  If not, see <http://www.gnu.org/licenses/>.
+
+ ***************************************************************************
+ This library is based on a prototype written by Arvind Raja and was
+ licensed under the LGPL with permission of the author. See Arvind Raja,
+ "Object-oriented implementations of Clifford algebras in C++: a prototype",
+ in Ablamowicz, Lounesto and Parra (eds.)
+ "Clifford algebras with numeric and symbolic computations, Birkhauser, 1996."
+ ***************************************************************************
+ See also Arvind Raja's original header comments and references in glucat.h
+ ***************************************************************************/
+
+#include "glucat/batch.h"
+
+#include <algorithm>
+
+namespace glucat
+{
+  /// Class name used in messages
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  const std::string
+  batch_product<Scalar_T,LO,HI>::
+  classname()
+  { return "batch_product"; }
+
+  /// Construct the table of products of basis elements for the given frame
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  batch_product<Scalar_T,LO,HI>::
+  batch_product(const index_set_t frm)
+  : m_frame(frm),
+    m_dim(set_value_t(1) << frm.count()),
+    m_sign(m_dim * m_dim)
+  {
+    const set_value_t dim = this->m_dim;
+    std::vector<index_set_t> basis(dim);
+    for (set_value_t
+        stv = 0;
+        stv != dim;
+        ++stv)
+      basis[stv] = index_set_t(stv, frm, true);
+    for (set_value_t
+        lhs_stv = 0;
+        lhs_stv != dim;
+        ++lhs_stv)
+      for (set_value_t
+          rhs_stv = 0;
+          rhs_stv != dim;
+          ++rhs_stv)
+        this->m_sign[lhs_stv * dim + rhs_stv] =
+          Scalar_T(basis[lhs_stv].sign_of_mult(basis[rhs_stv]));
+  }
+
+  /// Frame of each multivector in a batch
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  inline
+  const index_set<LO,HI>
+  batch_product<Scalar_T,LO,HI>::
+  frame() const
+  { return this->m_frame; }
+
+  /// Number of coordinates of each multivector in a batch
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  inline
+  set_value_t
+  batch_product<Scalar_T,LO,HI>::
+  dim() const
+  { return this->m_dim; }
+
+  /// Geometric products of a batch: result[i] = lhs[i] * rhs[i]
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  void
+  batch_product<Scalar_T,LO,HI>::
+  multiply(const Scalar_T* lhs, const Scalar_T* rhs, Scalar_T* result,
+           const size_type batch_size) const
+  {
+    // Accumulate the products for each block of the batch into block_result,
+    // which is small enough to stay in cache, then copy the block into result.
+    const set_value_t dim = this->m_dim;
+    const size_type block_size = std::max(size_type(1), size_type(block_coords / dim));
+    std::vector<Scalar_T> block_result(dim * block_size);
+    Scalar_T* block_ptr = &block_result[0];
+    for (size_type
+        block_begin = 0;
+        block_begin < batch_size;
+        block_begin += block_size)
+    {
+      const size_type block_len = std::min(block_size, batch_size - block_begin);
+      std::fill(block_result.begin(), block_result.end(), Scalar_T(0));
+      for (set_value_t
+          lhs_stv = 0;
+          lhs_stv != dim;
+          ++lhs_stv)
+      {
+        const Scalar_T* lhs_crds = lhs + lhs_stv * batch_size + block_begin;
+        const Scalar_T* sign_row = &this->m_sign[lhs_stv * dim];
+        for (set_value_t
+            rhs_stv = 0;
+            rhs_stv != dim;
+            ++rhs_stv)
+        {
+          const Scalar_T  sign = sign_row[rhs_stv];
+          const Scalar_T* rhs_crds = rhs + rhs_stv * batch_size + block_begin;
+          Scalar_T* result_crds = block_ptr + (lhs_stv ^ rhs_stv) * block_size;
+          for (size_type
+              i = 0;
+              i != block_len;
+              ++i)
+            result_crds[i] += sign * lhs_crds[i] * rhs_crds[i];
+        }
+      }
+      for (set_value_t
+          stv = 0;
+          stv != dim;
+          ++stv)
+      {
+        const Scalar_T* block_crds = block_ptr + stv * block_size;
+        std::copy(block_crds, block_crds + block_len, result + stv * batch_size + block_begin);
+      }
+    }
+  }
+
+  /// Store val as multivector i of a batch
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  void
+  batch_product<Scalar_T,LO,HI>::
+  pack(const framed_multi_t& val, Scalar_T* coords,
+       const size_type batch_size, const size_type i) const
+  {
+    if ((val.frame() | this->m_frame) != this->m_frame)
+      throw error_t("pack(val,coords,batch_size,i): cannot pack value outside of frame");
+    const set_value_t dim = this->m_dim;
+    for (set_value_t
+        stv = 0;
+        stv != dim;
+        ++stv)
+      coords[stv * batch_size + i] = Scalar_T(0);
+    typedef typename framed_multi_t::const_iterator const_iterator;
+    const const_iterator val_end = val.end();
+    for (const_iterator
+        val_it = val.begin();
+        val_it != val_end;
+        ++val_it)
+      coords[val_it->first.value_of_fold(this->m_frame) * batch_size + i] = val_it->second;
+  }
+
+  /// Multivector i of a batch
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  const framed_multi<Scalar_T,LO,HI>
+  batch_product<Scalar_T,LO,HI>::
+  unpack(const Scalar_T* coords,
+         const size_type batch_size, const size_type i) const
+  {
+    typedef typename framed_multi_t::term_t term_t;
+    framed_multi_t result;
+    const set_value_t dim = this->m_dim;
+    for (set_value_t
+        stv = 0;
+        stv != dim;
+        ++stv)
+    {
+      const Scalar_T crd = coords[stv * batch_size + i];
+      if (crd != Scalar_T(0))
+        result += term_t(index_set_t(stv, this->m_frame, true), crd);
+    }
+    return result;
+  }
+}
+#endif  // _GLUCAT_BATCH_IMP_H
@@ -0,0 +1,182 @@
+#ifndef _GLUCAT_CACHE_H
+#define _GLUCAT_CACHE_H
+/***************************************************************************
+    GluCat : Generic library of universal Clifford algebra templates
+    cache.h : Memory bounded least recently used caches
+                             -------------------
+    begin                : Sat 2026-10-17
+    copyright            : (C) 2001-2016 by Paul C. Leopardi
+ ***************************************************************************
+
+    This library is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published
+    by the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with this library.  If not, see <http://www.gnu.org/licenses/>.
+
+ ***************************************************************************
+ This library is based on a prototype written by Arvind Raja and was
+ licensed under the LGPL with permission of the author. See Arvind Raja,
+ "Object-oriented implementations of Clifford algebras in C++: a prototype",
+ in Ablamowicz, Lounesto and Parra (eds.)
+ "Clifford algebras with numeric and symbolic computations, Birkhauser, 1996."
+ ***************************************************************************
+ See also Arvind Raja's original header comments and references in glucat.h
+ ***************************************************************************/
+
+#include <cstddef>
+#include <list>
+#include <map>
+#include <utility>
+
+#if defined(_GLUCAT_USE_THREADS)
+#include <mutex>
+#endif
+
+namespace glucat
+{
+  /// Default memory budget of the cache of basis elements used by matrix_multi<>
+  const std::size_t DEFAULT_Basis_Cache_Max_Bytes     = std::size_t(1) << 26;
+  /// Default memory budget of the cache of generators used by matrix_multi<>
+  const std::size_t DEFAULT_Generator_Cache_Max_Bytes = std::size_t(1) << 26;
+
+#if defined(_GLUCAT_USE_THREADS)
+  typedef std::mutex                   cache_mutex_t;
+  typedef std::lock_guard<std::mutex>  cache_lock_t;
+#else
+  /// Without threads, a cache needs no locking
+  struct cache_mutex_t
+  { };
+  struct cache_lock_t
+  { explicit cache_lock_t(cache_mutex_t&) { } };
+#endif
+
+  /// Counters of the use of a cache
+  struct cache_stats
+  {
+    cache_stats()
+    : hits(0), misses(0), evictions(0), entries(0), bytes(0), max_bytes(0)
+    { }
+    /// Add the counters of another cache, such as another shard of the same cache
+    cache_stats& operator+= (const cache_stats& rhs)
+    {
+      this->hits      += rhs.hits;
+      this->misses    += rhs.misses;
+      this->evictions += rhs.evictions;
+      this->entries   += rhs.entries;
+      this->bytes     += rhs.bytes;
+      this->max_bytes += rhs.max_bytes;
+      return *this;
+    }
+    /// Number of lookups which found an entry
+    std::size_t hits;
+    /// Number of lookups which did not find an entry
+    std::size_t misses;
+    /// Number of entries removed to keep within the memory budget
+    std::size_t evictions;
+    /// Number of entries held
+    std::size_t entries;
+    /// Estimated number of bytes held by the entries
+    std::size_t bytes;
+    /// Memory budget
+    std::size_t max_bytes;
+  };
+
+  /// Cache which evicts its least recently used entries to keep within a memory budget.
+  // The size of each entry is estimated by the caller, when the entry is inserted.
+  // The cache does no locking of its own: each user of an lru_cache holds a lock
+  // on a cache_mutex_t around each call, and copies values out of the cache
+  // before releasing the lock, since a later insert may evict the entry.
+  template< typename Key_T, typename Value_T >
+  class lru_cache
+  {
+  public:
+    /// Construct an empty cache with the given memory budget
+    explicit lru_cache(const std::size_t max_bytes)
+    { this->m_stats.max_bytes = max_bytes; }
+
+    /// Pointer to the value for key, or 0 if none, counting a hit or a miss
+    Value_T* find(const Key_T& key)
+    {
+      const typename index_map_t::iterator index_it = this->m_index.find(key);
+      if (index_it == this->m_index.end())
+      {
+        ++this->m_stats.misses;
+        return 0;
+      }
+      ++this->m_stats.hits;
+      // Move the entry to the front of the list of entries
+      this->m_entries.splice(this->m_entries.begin(), this->m_entries, index_it->second);
+      return &(index_it->second->value);
+    }
+    /// Pointer to the value for key, or 0 if none, without counting or reordering
+    Value_T* peek(const Key_T& key)
+    {
+      const typename index_map_t::iterator index_it = this->m_index.find(key);
+      return (index_it == this->m_index.end())
+           ? 0
+           : &(index_it->second->value);
+    }
+    /// Insert a value of the given estimated size for key, as the most recently used entry
+    // If key is already in the cache, its value is kept.
+    // No entries are evicted: call evict() once the caller no longer needs any values.
+    Value_T& insert(const Key_T& key, const Value_T& val, const std::size_t bytes)
+    {
+      Value_T* old_val = this->peek(key);
+      if (old_val != 0)
+        return *old_val;
+      const entry_t entry = { key, val, bytes };
+      this->m_entries.push_front(entry);
+      this->m_index.insert(std::make_pair(key, this->m_entries.begin()));
+      ++this->m_stats.entries;
+      this->m_stats.bytes += bytes;
+      return this->m_entries.front().value;
+    }
+    /// Evict least recently used entries until the cache is within its memory budget
+    void evict()
+    {
+      while (this->m_stats.bytes > this->m_stats.max_bytes && !this->m_entries.empty())
+      {
+        const entry_t& entry = this->m_entries.back();
+        this->m_stats.bytes -= entry.bytes;
+        --this->m_stats.entries;
+        ++this->m_stats.evictions;
+        this->m_index.erase(entry.key);
+        this->m_entries.pop_back();
+      }
+    }
+    /// Change the memory budget, evicting entries if needed
+    void set_max_bytes(const std::size_t max_bytes)
+    {
+      this->m_stats.max_bytes = max_bytes;
+      this->evict();
+    }
+    /// Counters of the use of the cache
+    const cache_stats& stats() const
+    { return this->m_stats; }
+  private:
+    struct entry_t
+    {
+      Key_T       key;
+      Value_T     value;
+      std::size_t bytes;
+    };
+    typedef std::list<entry_t>                                 list_t;
+    typedef std::map<Key_T, typename list_t::iterator>         index_map_t;
+
+    /// Entries, most recently used first
+    list_t      m_entries;
+    /// Position of the entry for each key
+    index_map_t m_index;
+    /// Counters
+    cache_stats m_stats;
+  };
+}
+#endif  // _GLUCAT_CACHE_H
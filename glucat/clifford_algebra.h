@@ -63,6 +63,8 @@ namespace glucat
     virtual multivector_t&      operator+=  (const Scalar_T& scr) =0;
     /// Geometric difference
     virtual multivector_t&      operator-=  (const multivector_t& rhs) =0;
+    /// Geometric sum of multivector and product of multivector and scalar
+    virtual multivector_t&      add_scaled  (const multivector_t& rhs, const Scalar_T& crd) =0;
     /// Unary -
     virtual const multivector_t operator-   () const =0;
     /// Product of multivector and scalar
@@ -137,6 +139,17 @@ namespace glucat
     multivector_t&      operator+=  (const multivector_t& rhs);       \
     multivector_t&      operator+=  (const Scalar_T& scr);            \
     multivector_t&      operator-=  (const multivector_t& rhs);       \
+    multivector_t&      add_scaled                                    \
+         (const multivector_t& rhs, const Scalar_T& crd);             \
+    template< typename Expr_T >                                       \
+    multivector_t&      operator=                                     \
+         (const lazy_expr<Expr_T, multivector_t>& rhs);               \
+    template< typename Expr_T >                                       \
+    multivector_t&      operator+=                                    \
+         (const lazy_expr<Expr_T, multivector_t>& rhs);               \
+    template< typename Expr_T >                                       \
+    multivector_t&      operator-=                                    \
+         (const lazy_expr<Expr_T, multivector_t>& rhs);               \
     const multivector_t operator-   () const;                         \
     multivector_t&      operator*=  (const Scalar_T& scr);            \
     multivector_t&      operator*=  (const multivector_t& rhs);       \
@@ -560,6 +573,61 @@ namespace glucat
   const Multivector<Scalar_T,LO,HI>
   sqrt(const Multivector<Scalar_T,LO,HI>& val);
 
+  // Polynomial evaluation
+
+  /// Powers val, val^2, ..., val^s for the Paterson-Stockmeyer evaluation of polynomials in val
+  // Chooses s to minimize the number of products needed by nbr_polys polynomials of the given degree.
+  // Any leading entries of powers must already be val, val^2, ..., and are reused.
+  // val must not refer to an entry of powers.
+  template
+  <
+    template<typename, const index_t, const index_t> class Multivector,
+    typename Scalar_T, const index_t LO, const index_t HI
+  >
+  void
+  paterson_stockmeyer_powers(const Multivector<Scalar_T,LO,HI>& val, const int degree, const int nbr_polys,
+                             std::vector< Multivector<Scalar_T,LO,HI> >& powers);
+
+  /// Polynomial c[0] + c[1]*val + ... + c[degree]*val^degree, by the Paterson-Stockmeyer method
+  // powers must be the result of paterson_stockmeyer_powers() for val and at least this degree.
+  template
+  <
+    template<typename, const index_t, const index_t> class Multivector,
+    typename Scalar_T, const index_t LO, const index_t HI
+  >
+  const Multivector<Scalar_T,LO,HI>
+  paterson_stockmeyer(const Scalar_T c[], const int degree,
+                      const std::vector< Multivector<Scalar_T,LO,HI> >& powers);
+
+  // Closed forms of transcendental functions
+
+  /// Exponential of multivector, in closed form
+  // Applies if the pure part of val has a single grade and a scalar square, or is a
+  // bivector with at most two commuting simple parts, with real and distinct squares.
+  // Returns false, leaving result unchanged, if no closed form applies.
+  template
+  <
+    template<typename, const index_t, const index_t> class Multivector,
+    typename Scalar_T, const index_t LO, const index_t HI
+  >
+  bool
+  closed_form_exp(const Multivector<Scalar_T,LO,HI>& val, Multivector<Scalar_T,LO,HI>& result);
+
+  /// Natural logarithm of multivector, in closed form
+  // Applies if the pure part of val has a single grade and a scalar square, or if val is
+  // a rotor whose bivector part has at most two commuting simple parts, with negative and
+  // distinct squares, and if no eigenvalue of val is real and negative.
+  // Does not apply if the scalar part of val is negative, so that the result is always
+  // on the same branch as the general logarithm.
+  // Returns false, leaving result unchanged, if no closed form applies.
+  template
+  <
+    template<typename, const index_t, const index_t> class Multivector,
+    typename Scalar_T, const index_t LO, const index_t HI
+  >
+  bool
+  closed_form_log(const Multivector<Scalar_T,LO,HI>& val, Multivector<Scalar_T,LO,HI>& result);
+
   // Transcendental functions
 
   /// Exponential of multivector
@@ -32,6 +32,11 @@
  ***************************************************************************/
 
 // References for algorithms:
+// [AMH]:
+// Awad H. Al-Mohy and Nicholas J. Higham,
+// "A New Scaling and Squaring Algorithm for the Matrix Exponential",
+// SIAM Journal on Matrix Analysis and Applications,
+// Vol. 31, Issue 3 (2009), pp. 970-989.
 // [AS]:
 // Milton Abramowicz and Irene A. Stegun, "Handbook of mathematical functions",
 // Dover 1972, first published 1965.
@@ -39,6 +44,9 @@
 // Sheung Hun Cheng, Nicholas J. Higham, Charles S. Kenney and Alan J. Laub,
 // "Approximating the Logarithm of a Matrix to Specified Accuracy", 1999.
 // ftp://ftp.ma.man.ac.uk/pub/narep/narep353.ps.gz
+// [G]:
+// David Goldberg, "What every computer scientist should know about
+// floating-point arithmetic", ACM Computing Surveys, Vol. 23, Issue 1 (1991), pp. 5-48.
 // [GL]:
 // Gene H. Golub and Charles F. van Loan,
 // "Matrix Computations", 3rd ed., Johns Hopkins UP, 1996.
@@ -50,6 +58,16 @@
 // "The Scaling and Squaring Method for the Matrix Exponential Revisited",
 // SIAM Journal on Matrix Analysis and Applications,
 // Vol. 26,  Issue 4 (2005), pp. 1179-1193.
+// [HFM]:
+// Nicholas J. Higham, "Functions of Matrices: Theory and Computation",
+// SIAM, 2008.
+// [PS]:
+// Michael S. Paterson and Larry J. Stockmeyer, "On the number of nonscalar
+// multiplications necessary to evaluate polynomials",
+// SIAM Journal on Computing, Vol. 2, Issue 1 (1973), pp. 60-66.
+// [RD]:
+// Martin Roelfs and Steven De Keninck, "Graded Symmetry Groups: Plane and Simple",
+// Advances in Applied Clifford Algebras, Vol. 33, Article 30 (2023).
 // [Z]:
 // Doron Zeilberger, "PADE" (Maple code), 2002.
 // http://www.math.rutgers.edu/~zeilberg/tokhniot/PADE
@@ -343,9 +361,14 @@ namespace glucat
     multivector_t result = Scalar_T(1);
     for (;
         rhs != 0;
-        rhs >>= 1, a *= a)
+        rhs >>= 1)
+    {
       if (rhs & 1)
         result *= a;
+      // Do not square a after its last use
+      if (rhs > 1)
+        a *= a;
+    }
     return result;
   }
 
@@ -597,6 +620,136 @@ namespace glucat
   sqrt(const Multivector<Scalar_T,LO,HI>& val)
   { return sqrt(val, complexifier(val), true); }
 
+  /// Powers val, val^2, ..., val^s for the Paterson-Stockmeyer evaluation of polynomials in val
+  template< template<typename, const index_t, const index_t> class Multivector,
+            typename Scalar_T, const index_t LO, const index_t HI >
+  void
+  paterson_stockmeyer_powers(const Multivector<Scalar_T,LO,HI>& val, const int degree, const int nbr_polys,
+                             std::vector< Multivector<Scalar_T,LO,HI> >& powers)
+  {
+    // Reference: [PS], [HFM], Section 4.2
+    // With powers up to val^s, each polynomial needs ceil(degree/s) - 1 further products,
+    // in Horner's method in val^s.
+    int nbr_powers = 1;
+    int min_cost = nbr_polys * (degree - 1);
+    for (int
+        s = 2;
+        s <= degree;
+        ++s)
+    {
+      const int cost = (s - 1) + nbr_polys * ((degree + s - 1)/s - 1);
+      if (cost < min_cost)
+      {
+        min_cost = cost;
+        nbr_powers = s;
+      }
+    }
+    // Reuse any powers already computed by the caller
+    const int nbr_known = std::min(int(powers.size()), nbr_powers);
+    powers.resize(nbr_powers);
+    if (nbr_known == 0)
+      powers[0] = val;
+    for (int
+        k = std::max(nbr_known, 1);
+        k != nbr_powers;
+        ++k)
+      powers[k] = powers[k-1] * val;
+  }
+
+  /// Polynomial c[0] + c[1]*val + ... + c[degree]*val^degree, by the Paterson-Stockmeyer method
+  template< template<typename, const index_t, const index_t> class Multivector,
+            typename Scalar_T, const index_t LO, const index_t HI >
+  const Multivector<Scalar_T,LO,HI>
+  paterson_stockmeyer(const Scalar_T c[], const int degree,
+                      const std::vector< Multivector<Scalar_T,LO,HI> >& powers)
+  {
+    // Reference: [PS], [HFM], Section 4.2
+    // The polynomial is a polynomial in val^s whose coefficients are the blocks
+    // c[s*k] + c[s*k+1]*val + ... + c[s*k+s-1]*val^(s-1), evaluated by Horner's method.
+    // A block which is only a scalar needs no product.
+    typedef Multivector<Scalar_T,LO,HI> multivector_t;
+
+    const int s = powers.size();
+    const multivector_t& val_s = powers[s-1];
+    const int top_block = degree / s;
+    // Start within the frame of val, so that each sum needs no reframing
+    multivector_t result(Scalar_T(0), val_s.frame());
+    // Use compensated summation: residual is the error in result, which is
+    // multiplied by val^s along with result at each step of Horner's method
+    multivector_t residual(Scalar_T(0), val_s.frame());
+    bool is_scalar = true;
+    for (int
+        k = top_block;
+        k >= 0;
+        --k)
+    {
+      if (k != top_block)
+      {
+        if (is_scalar)
+        { // The residual is also a scalar, and is applied before the product
+          result = val_s * (result.scalar() - residual.scalar());
+          residual = multivector_t(Scalar_T(0), val_s.frame());
+        }
+        else
+        {
+          result *= val_s;
+          residual *= val_s;
+        }
+      }
+      // Add the terms of the block in order of increasing size
+      const int block_degree = std::min(s - 1, degree - s*k);
+      for (int
+          j = block_degree;
+          j >= 0;
+          --j)
+      {
+        const multivector_t& term = (j == 0)
+                                  ? c[s*k] - residual
+                                  : powers[j-1] * c[s*k + j] - residual;
+        const multivector_t& sum = result + term;
+        residual = (sum - result) - term;
+        result = sum;
+      }
+      is_scalar = is_scalar && (block_degree == 0);
+    }
+    return result;
+  }
+
+  /// Largest norm of A for which the Pade' approximant of degree m to exp(A) is accurate
+  template< typename Scalar_T >
+  static
+  Scalar_T
+  exp_pade_theta(const int m)
+  {
+    // Reference: [H], Section 3
+    // The relative backward error of the diagonal Pade' approximant of degree m is
+    // dominated by the leading term c*x^(2*m) of its series, c == (m!)^2/((2*m)!*(2*m+1)!).
+    // theta_m solves c*theta_m^(2*m) == u, the unit roundoff of Scalar_T.
+    // For double, this agrees with the values of theta_m in [H] to within 1%.
+    typedef numeric_traits<Scalar_T> traits_t;
+    double log_c = -std::log(double(2*m + 1));
+    for (int
+        k = 1;
+        k <= m;
+        ++k)
+      log_c -= 2.0*std::log(double(m + k));
+    const double log_u = std::log(traits_t::to_double(std::numeric_limits<Scalar_T>::epsilon())/2.0);
+    return Scalar_T(std::exp((log_u - log_c)/(2*m)));
+  }
+
+  /// Root of order k of a non-negative scalar
+  template< typename Scalar_T >
+  inline
+  static
+  Scalar_T
+  nonneg_root(const Scalar_T& val, const int k)
+  {
+    typedef numeric_traits<Scalar_T> traits_t;
+    return (val == Scalar_T(0))
+      ? Scalar_T(0)
+      : traits_t::exp(traits_t::log(val)/Scalar_T(k));
+  }
+
   /// Exponential of multivector
   template< template<typename, const index_t, const index_t> class Multivector,
             typename Scalar_T, const index_t LO, const index_t HI >
@@ -605,7 +758,7 @@ namespace glucat
   {
     // Scaling and squaring Pade' approximation of matrix exponential
     // Reference: [GL], Section 11.3, p572-576
-    // Reference: [H]
+    // Reference: [H], [AMH]
 
     typedef numeric_traits<Scalar_T> traits_t;
 
@@ -625,67 +778,79 @@ namespace glucat
     if (pure_scale2 == Scalar_T(0))
       return scalar_exp;
 
-    const int ilog2_scale =
-      std::max(0, traits_t::to_int(ceil((log2(pure_scale2) + Scalar_T(A.frame().count()))/Scalar_T(2))) - 3);
-    const Scalar_T i_scale = traits_t::pow(Scalar_T(2), ilog2_scale);
-    if (traits_t::isNaN_or_isInf(i_scale))
-      return traits_t::NaN();
-
-    A /= i_scale;
-    multivector_t pure_exp;
+    // The matrix of each basis element is orthogonal, so the 2-norm of the matrix of
+    // a multivector X within the frame of A is at most sqrt(norm(X) * frame_dim).
+    const Scalar_T frame_dim = traits_t::pow(Scalar_T(2), A.frame().count());
+    const Scalar_T norm_A = traits_t::sqrt(pure_scale2 * frame_dim);
+
+    // U and V below are polynomials in A*A, evaluated by the Paterson-Stockmeyer method
+    multivector_t AA = A * A;
+    std::vector<multivector_t> powers;
+
+    // Use the Pade' approximant of lowest degree among 3, 5, 7, 9, 13, 17, ..., max_degree
+    // which is accurate for A, and otherwise use max_degree with the fewest squarings.
+    typedef std::numeric_limits<Scalar_T> limits_t;
+    const int max_degree = 4*(limits_t::digits / 32) + 9;
+    int degree = 3;
+    int ilog2_scale = 0;
+    if (norm_A > exp_pade_theta<Scalar_T>(degree))
     {
-      typedef std::numeric_limits<Scalar_T> limits_t;
-      const int nbr_even_powers = 2*(limits_t::digits / 32) + 4;
-
-      // Create an array of coefficients
-      const int max_power = 2*nbr_even_powers + 1;
-      static Scalar_T c[max_power+1];
-      if (c[0] != Scalar_T(1))
+      // alpha == max(||A^4||^(1/4), ||A^6||^(1/6)) is at most ||A||, and also bounds the backward error.
+      // Reference: [AMH], Section 4
+      powers.push_back(AA);
+      powers.push_back(AA * AA);
+      const Scalar_T norm_A2 = traits_t::sqrt(AA.norm() * frame_dim);
+      const Scalar_T norm_A4 = traits_t::sqrt(powers[1].norm() * frame_dim);
+      const Scalar_T d4 = nonneg_root(norm_A4, 4);
+      const Scalar_T d6 = nonneg_root(norm_A4 * norm_A2, 6);
+      const Scalar_T alpha = std::min(norm_A, std::max(d4, d6));
+      while (degree != max_degree && alpha > exp_pade_theta<Scalar_T>(degree))
+        degree += (degree < 9) ? 2 : 4;
+      const Scalar_T max_theta = exp_pade_theta<Scalar_T>(max_degree);
+      if (alpha > max_theta)
       {
-        c[0] = Scalar_T(1);
+        ilog2_scale = traits_t::to_int(ceil(traits_t::log2(alpha / max_theta)));
+        const Scalar_T i_scale = traits_t::pow(Scalar_T(2), ilog2_scale);
+        if (traits_t::isNaN_or_isInf(i_scale))
+          return traits_t::NaN();
+        A /= i_scale;
+        AA /= i_scale;
+        AA /= i_scale;
+        powers[0] = AA;
         for (int
             k = 0;
-            k != max_power;
+            k != 4;
             ++k)
-          c[k+1] = c[k]*(max_power-k) / ((2*max_power-k)*(k+1));
+          powers[1] /= i_scale;
       }
+    }
 
-      // Create an array of even powers
-      multivector_t AA[nbr_even_powers];
-      AA[0] = A * A;
-      AA[1] = AA[0] * AA[0];
-      for (int
-        k = 2;
-        k != nbr_even_powers;
-        ++k)
-        AA[k] = AA[k-2] * AA[1];
-
-      // Use compensated summation to calculate U and AV
-      multivector_t residual = 0;
-      multivector_t U = c[0];
+    multivector_t pure_exp;
+    {
+      // Create arrays of the even and odd coefficients of the Pade' approximant
+      const int nbr_even_powers = degree / 2;
+      Scalar_T c[max_degree+1];
+      c[0] = Scalar_T(1);
       for (int
           k = 0;
-          k != nbr_even_powers;
+          k != degree;
           ++k)
-      {
-        const multivector_t& term = AA[k]*c[2*k + 2] - residual;
-        const multivector_t& sum = U + term;
-        residual = (sum - U) - term;
-        U = sum;
-      }
-      residual = 0;
-      multivector_t AV = c[1];
+        c[k+1] = c[k]*(degree-k) / ((2*degree-k)*(k+1));
+      Scalar_T c_even[max_degree/2 + 1];
+      Scalar_T c_odd[max_degree/2 + 1];
       for (int
           k = 0;
-          k != nbr_even_powers;
+          k <= nbr_even_powers;
           ++k)
       {
-        const multivector_t& term = AA[k]*c[2*k + 3] - residual;
-        const multivector_t& sum = AV + term;
-        residual = (sum - AV) - term;
-        AV = sum;
+        c_even[k] = c[2*k];
+        c_odd[k] = c[2*k + 1];
       }
-      AV *= A;
+
+      // U and V share the powers of A*A
+      paterson_stockmeyer_powers(AA, nbr_even_powers, 2, powers);
+      const multivector_t& U = paterson_stockmeyer(c_even, nbr_even_powers, powers);
+      const multivector_t& AV = A * paterson_stockmeyer(c_odd, nbr_even_powers, powers);
       pure_exp = (U+AV) / (U-AV);
     }
     for (int
@@ -696,6 +861,315 @@ namespace glucat
     return pure_exp * scalar_exp;
   }
 
+  /// Square of the relative size below which a term of a closed form is treated as roundoff
+  template< typename Scalar_T >
+  inline
+  static
+  Scalar_T
+  closed_form_tol2(const index_t frame_count)
+  {
+    const Scalar_T tol = std::numeric_limits<Scalar_T>::epsilon() * Scalar_T(std::max(frame_count, index_t(1)));
+    return tol * tol;
+  }
+
+  /// Argument of the complex number x + y*i, in (-pi, pi]
+  template< typename Scalar_T >
+  static
+  Scalar_T
+  complex_arg(const Scalar_T& x, const Scalar_T& y)
+  {
+    // Use the half angle formulas, which avoid cancellation, instead of atan2
+    typedef numeric_traits<Scalar_T> traits_t;
+    const Scalar_T r = traits_t::sqrt(x*x + y*y);
+    if (x > Scalar_T(0))
+      return Scalar_T(2) * traits_t::atan(y / (r + x));
+    else if (y != Scalar_T(0))
+      return Scalar_T(2) * traits_t::atan((r - x) / y);
+    else if (x < Scalar_T(0))
+      return traits_t::pi();
+    else
+      return Scalar_T(0);
+  }
+
+  /// log(1 + val), accurate also when val is small
+  template< typename Scalar_T >
+  static
+  Scalar_T
+  log_1_plus(const Scalar_T& val)
+  {
+    // Reference: [G], Theorem 4
+    typedef numeric_traits<Scalar_T> traits_t;
+    const Scalar_T w = Scalar_T(1) + val;
+    return (w == Scalar_T(1))
+      ? val
+      : traits_t::log(w) * val / (w - Scalar_T(1));
+  }
+
+  /// Coefficients of exp(val) == c + s*val, where val*val == sq, a scalar
+  template< typename Scalar_T >
+  static
+  void
+  scalar_square_exp(const Scalar_T& sq, Scalar_T& c, Scalar_T& s)
+  {
+    typedef numeric_traits<Scalar_T> traits_t;
+    if (sq < Scalar_T(0))
+    { // val behaves as i*r, with r real
+      const Scalar_T r = traits_t::sqrt(-sq);
+      c = traits_t::cos(r);
+      s = traits_t::sin(r) / r;
+    }
+    else if (sq > Scalar_T(0))
+    { // val behaves as a real number r, with r > 0
+      const Scalar_T r = traits_t::sqrt(sq);
+      c = traits_t::cosh(r);
+      s = traits_t::sinh(r) / r;
+    }
+    else
+    { // val is nilpotent
+      c = Scalar_T(1);
+      s = Scalar_T(1);
+    }
+  }
+
+  /// Coefficients of log(a + val) == l + t*val, where val*val == sq, a scalar
+  // Returns false if a + val has an eigenvalue which is real and not positive,
+  // so that the logarithm depends on the complexifier.
+  template< typename Scalar_T >
+  static
+  bool
+  scalar_square_log(const Scalar_T& a, const Scalar_T& sq, Scalar_T& l, Scalar_T& t)
+  {
+    typedef numeric_traits<Scalar_T> traits_t;
+    if (sq < Scalar_T(0))
+    { // a + val behaves as the complex number a + i*r, with r > 0
+      const Scalar_T r = traits_t::sqrt(-sq);
+      l = traits_t::log(a*a + r*r) / Scalar_T(2);
+      t = complex_arg(a, r) / r;
+    }
+    else if (sq > Scalar_T(0))
+    { // a + val has the eigenvalues a - r and a + r
+      const Scalar_T r = traits_t::sqrt(sq);
+      if (a <= r)
+        return false;
+      l = traits_t::log((a - r) * (a + r)) / Scalar_T(2);
+      t = log_1_plus(Scalar_T(2) * r / (a - r)) / (Scalar_T(2) * r);
+    }
+    else
+    { // a + val == a * (1 + val/a), where val is nilpotent
+      if (a <= Scalar_T(0))
+        return false;
+      l = traits_t::log(a);
+      t = Scalar_T(1) / a;
+    }
+    return !traits_t::isNaN_or_isInf(l) && !traits_t::isNaN_or_isInf(t);
+  }
+
+  /// Split a bivector into commuting simple parts: val == part1 + part2, part1*part1 == sq1, part2*part2 == sq2
+  // Returns false if val has more than two such parts, or if sq1 and sq2 are not real,
+  // or are too close to separate accurately. If val is simple, part2 and sq2 are 0.
+  template< template<typename, const index_t, const index_t> class Multivector,
+            typename Scalar_T, const index_t LO, const index_t HI >
+  static
+  bool
+  bivector_split(const Multivector<Scalar_T,LO,HI>& val,
+                 Multivector<Scalar_T,LO,HI>& part1, Multivector<Scalar_T,LO,HI>& part2,
+                 Scalar_T& sq1, Scalar_T& sq2)
+  {
+    // Invariant decomposition of a bivector
+    // Reference: [RD]
+    // If val == b1 + b2 with b1*b2 == b2*b1 == b1^b2, then W2 == (val^val)/2 == b1*b2,
+    // star(val,val) == sq1 + sq2, star(W2,W2) == sq1*sq2, and W2*val == sq1*b2 + sq2*b1.
+    typedef numeric_traits<Scalar_T> traits_t;
+    typedef Multivector<Scalar_T,LO,HI> multivector_t;
+
+    const Scalar_T tol2 = closed_form_tol2<Scalar_T>(val.frame().count());
+    const Scalar_T norm_val = val.norm();
+    const Scalar_T e1 = star(val, val);
+    const multivector_t& W2 = (val ^ val) / Scalar_T(2);
+    if (W2.norm() <= tol2 * norm_val * norm_val)
+    { // val is simple
+      part1 = val;
+      part2 = Scalar_T(0);
+      sq1 = e1;
+      sq2 = Scalar_T(0);
+      return true;
+    }
+    // val must not have a third part
+    if ((W2 ^ val).norm() > tol2 * norm_val * norm_val * norm_val)
+      return false;
+
+    // sq1 and sq2 are the roots of x^2 - e1*x + e2, with |sq1| >= |sq2|
+    const Scalar_T e2 = star(W2, W2);
+    const Scalar_T disc = e1*e1 - Scalar_T(4)*e2;
+    if (disc < Scalar_T(0))
+      return false;
+    const Scalar_T root = traits_t::sqrt(disc);
+    sq1 = (e1 < Scalar_T(0))
+        ? (e1 - root) / Scalar_T(2)
+        : (e1 + root) / Scalar_T(2);
+    // The error in part1 grows as |sq1| / |sq1 - sq2|
+    if (root * Scalar_T(8) < traits_t::abs(sq1))
+      return false;
+    sq2 = e2 / sq1;
+
+    part1 = ((sq1 - W2) * val)(2) / (sq1 - sq2);
+    part2 = val - part1;
+    return !part1.isnan();
+  }
+
+  /// Exponential of multivector, in closed form
+  template< template<typename, const index_t, const index_t> class Multivector,
+            typename Scalar_T, const index_t LO, const index_t HI >
+  bool
+  closed_form_exp(const Multivector<Scalar_T,LO,HI>& val, Multivector<Scalar_T,LO,HI>& result)
+  {
+    // Reference: [RD]
+    typedef numeric_traits<Scalar_T> traits_t;
+    typedef Multivector<Scalar_T,LO,HI> multivector_t;
+
+    const Scalar_T scalar_val = scalar(val);
+    const multivector_t& A = val - scalar_val;
+    const index_t grade = A.grade();
+    if (A != A(grade))
+      return false;
+
+    multivector_t part1;
+    multivector_t part2;
+    Scalar_T sq1;
+    Scalar_T sq2;
+    if (grade == 2)
+    {
+      if (!bivector_split(A, part1, part2, sq1, sq2))
+        return false;
+    }
+    else
+    {
+      const multivector_t& AA = A * A;
+      sq1 = scalar(AA);
+      const Scalar_T norm_A = A.norm();
+      if ((AA - sq1).norm() > closed_form_tol2<Scalar_T>(A.frame().count()) * norm_A * norm_A)
+        return false;
+      part1 = A;
+      sq2 = Scalar_T(0);
+    }
+
+    // exp(A) == exp(part1) * exp(part2), since part1 and part2 commute
+    const Scalar_T scalar_exp = traits_t::exp(scalar_val);
+    if (traits_t::isNaN_or_isInf(scalar_exp))
+      return false;
+    Scalar_T c1;
+    Scalar_T s1;
+    scalar_square_exp(sq1, c1, s1);
+    multivector_t pure_exp = part1 * (s1 * scalar_exp);
+    if (part2 == Scalar_T(0))
+      pure_exp += c1 * scalar_exp;
+    else
+    {
+      Scalar_T c2;
+      Scalar_T s2;
+      scalar_square_exp(sq2, c2, s2);
+      pure_exp *= c2;
+      pure_exp += lazy(part2) * (c1 * s2 * scalar_exp);
+      pure_exp += lazy(part1 ^ part2) * (s1 * s2 * scalar_exp);
+      pure_exp += c1 * c2 * scalar_exp;
+    }
+    if (pure_exp.isnan())
+      return false;
+    result = pure_exp;
+    return true;
+  }
+
+  /// Natural logarithm of multivector, in closed form
+  template< template<typename, const index_t, const index_t> class Multivector,
+            typename Scalar_T, const index_t LO, const index_t HI >
+  bool
+  closed_form_log(const Multivector<Scalar_T,LO,HI>& val, Multivector<Scalar_T,LO,HI>& result)
+  {
+    // Reference: [RD]
+    typedef numeric_traits<Scalar_T> traits_t;
+    typedef Multivector<Scalar_T,LO,HI> multivector_t;
+
+    // If the scalar part is negative, the general logarithm is log(-val) + i*pi,
+    // which is not on the principal branch used here, eg. for a rotor turning by more than pi/2
+    const Scalar_T a = scalar(val);
+    if (a < Scalar_T(0))
+      return false;
+    const multivector_t& Y = val - a;
+    const index_t grade = Y.grade();
+    const Scalar_T tol2 = closed_form_tol2<Scalar_T>(val.frame().count());
+    Scalar_T l;
+    Scalar_T t;
+    if (grade != 2 && Y == Y(grade))
+    { // val == a + Y, where Y has a single grade: Y*Y must be scalar
+      const multivector_t& YY = Y * Y;
+      const Scalar_T sq = scalar(YY);
+      const Scalar_T norm_Y = Y.norm();
+      if ((YY - sq).norm() > tol2 * norm_Y * norm_Y)
+        return false;
+      if (!scalar_square_log(a, sq, l, t))
+        return false;
+      result = Y * t + l;
+      return true;
+    }
+
+    // val == a + B + Q, where B is a bivector and Q is a 4-vector
+    const multivector_t& B = Y(2);
+    const multivector_t& Q = Y(4);
+    if (Y != B + Q)
+      return false;
+    multivector_t part1;
+    multivector_t part2;
+    Scalar_T sq1;
+    Scalar_T sq2;
+    if (!bivector_split(B, part1, part2, sq1, sq2))
+      return false;
+    const Scalar_T norm_val = val.norm();
+    if (part2 == Scalar_T(0))
+    { // B is simple
+      if (Q.norm() > tol2 * norm_val)
+        return false;
+      if (!scalar_square_log(a, sq1, l, t))
+        return false;
+      result = B * t + l;
+      return true;
+    }
+    if (sq1 >= Scalar_T(0) || sq2 >= Scalar_T(0))
+      return false;
+
+    // With unit parts u1 and u2 of B and J == u1*u2, val == a + x1*u1 + x2*u2 + x12*J.
+    // Since u1*u1 == u2*u2 == -1, the maps u1 -> i, u2 -> i and u1 -> i, u2 -> -i
+    // are homomorphisms onto the complex numbers, taking val to zp and zm.
+    // The logarithm of val is the element taken to log(zp) and log(zm).
+    const Scalar_T x1 = traits_t::sqrt(-sq1);
+    const Scalar_T x2 = traits_t::sqrt(-sq2);
+    const multivector_t& u1 = part1 / x1;
+    const multivector_t& u2 = part2 / x2;
+    const multivector_t& J = u1 ^ u2;
+    const Scalar_T x12 = star(Q, J);
+    if ((Q - J * x12).norm() > tol2 * norm_val)
+      return false;
+
+    const Scalar_T zp_re = a - x12;
+    const Scalar_T zp_im = x1 + x2;
+    const Scalar_T zm_re = a + x12;
+    const Scalar_T zm_im = x1 - x2;
+    if (zm_im == Scalar_T(0) && zm_re <= Scalar_T(0))
+      return false;
+    const Scalar_T log_abs_zp = traits_t::log(zp_re*zp_re + zp_im*zp_im) / Scalar_T(2);
+    const Scalar_T log_abs_zm = traits_t::log(zm_re*zm_re + zm_im*zm_im) / Scalar_T(2);
+    const Scalar_T arg_zp = complex_arg(zp_re, zp_im);
+    const Scalar_T arg_zm = complex_arg(zm_re, zm_im);
+    if (traits_t::isNaN_or_isInf(log_abs_zp) || traits_t::isNaN_or_isInf(log_abs_zm))
+      return false;
+
+    multivector_t log_val = u1 * ((arg_zp + arg_zm) / Scalar_T(2));
+    log_val += lazy(u2) * ((arg_zp - arg_zm) / Scalar_T(2));
+    log_val += lazy(J) * ((log_abs_zm - log_abs_zp) / Scalar_T(2));
+    log_val += (log_abs_zp + log_abs_zm) / Scalar_T(2);
+    result = log_val;
+    return true;
+  }
+
   /// Natural logarithm of multivector with specified complexifier
   template< template<typename, const index_t, const index_t> class Multivector,
             typename Scalar_T, const index_t LO, const index_t HI >
@@ -0,0 +1,143 @@
+#ifndef _GLUCAT_DIVISOR_H
+#define _GLUCAT_DIVISOR_H
+/***************************************************************************
+    GluCat : Generic library of universal Clifford algebra templates
+    divisor.h : Declare a class for repeated geometric quotients by one multivector
+                             -------------------
+    begin                : Sat 2026-10-17
+    copyright            : (C) 2001-2016 by Paul C. Leopardi
+ ***************************************************************************
+
+    This library is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published
+    by the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with this library.  If not, see <http://www.gnu.org/licenses/>.
+
+ ***************************************************************************
+ This library is based on a prototype written by Arvind Raja and was
+ licensed under the LGPL with permission of the author. See Arvind Raja,
+ "Object-oriented implementations of Clifford algebras in C++: a prototype",
+ in Ablamowicz, Lounesto and Parra (eds.)
+ "Clifford algebras with numeric and symbolic computations, Birkhauser, 1996."
+ ***************************************************************************
+ See also Arvind Raja's original header comments and references in glucat.h
+ ***************************************************************************/
+
+#include "glucat/global.h"
+#include "glucat/errors.h"
+#include "glucat/scalar.h"
+#include "glucat/index_set.h"
+#include "glucat/matrix_backend.h"
+#include "glucat/matrix_multi.h"
+
+# if  defined(_GLUCAT_GCC_IGNORE_UNUSED_LOCAL_TYPEDEFS)
+#  pragma GCC diagnostic push
+#  pragma GCC diagnostic ignored "-Wunused-local-typedefs"
+# endif
+#include <boost/numeric/ublas/lu.hpp>
+# if defined(_GLUCAT_GCC_IGNORE_UNUSED_LOCAL_TYPEDEFS)
+#  pragma GCC diagnostic pop
+# endif
+
+#include <string>
+#include <vector>
+
+namespace glucat
+{
+  /// LU factorization of a multivector, for geometric quotients of many multivectors by it.
+  // Usage:
+  //   const divisor<double> d(rhs);
+  //   x = lhs / d;                 // same as lhs / rhs
+  //   d.quotient(lhs_vec, x_vec);  // x_vec[i] = lhs_vec[i] / rhs, as one multi-column solve
+  //   y = d.inv();                 // same as inv(rhs)
+  // The constructor factorizes the transpose of the matrix of rhs once. Each quotient
+  // then needs only LU substitution and iterative refinement, as in operator/.
+  // If a numerator does not lie within the frame of the divisor, the divisor is
+  // factorized again within the common frame, for that quotient only.
+  // Tune_P::div_factor_precision and Tune_P::div_residual_precision select mixed
+  // precision refinement: the factorization in the demoted scalar type, and the
+  // residual in the promoted scalar type.
+  template< typename Scalar_T = double, const index_t LO = DEFAULT_LO, const index_t HI = DEFAULT_HI >
+  class divisor
+  {
+  public:
+    typedef divisor                                    divisor_t;
+    typedef Scalar_T                                   scalar_t;
+    typedef index_set<LO,HI>                           index_set_t;
+    typedef matrix_multi<Scalar_T,LO,HI>               matrix_multi_t;
+    typedef error<divisor_t>                           error_t;
+
+    /// Class name used in messages
+    static const std::string classname();
+    /// Factorize val within its own frame
+    explicit divisor(const matrix_multi_t& val);
+
+    /// Frame of the divisor
+    const index_set_t    frame() const;
+    /// Is the divisor singular, so that every quotient is NaN?
+    bool                 is_singular() const;
+
+    /// Geometric quotient lhs / val
+    const matrix_multi_t quotient(const matrix_multi_t& lhs) const;
+    /// Geometric quotients of a batch: result[i] = lhs[i] / val
+    void                 quotient(const std::vector<matrix_multi_t>& lhs,
+                                  std::vector<matrix_multi_t>& result) const;
+    /// Clifford multiplicative inverse of val
+    const matrix_multi_t inv() const;
+  private:
+    typedef typename matrix_multi_t::matrix_t          matrix_t;
+    typedef matrix::backend_t                          backend_t;
+    typedef backend_t::pivot_t                         pivot_t;
+    typedef typename numeric_traits<Scalar_T>::demoted::type
+                                                       demoted_scalar_t;
+    typedef typename matrix_multi<demoted_scalar_t,LO,HI>::matrix_t
+                                                       demoted_matrix_t;
+    typedef typename numeric_traits<Scalar_T>::promoted::type
+                                                       promoted_scalar_t;
+    typedef typename matrix_multi<promoted_scalar_t,LO,HI>::matrix_t
+                                                       promoted_matrix_t;
+
+    /// Solve AT*XT == BT, where BT holds nbr_blocks square blocks side by side
+    void                 solve(const matrix_t& BT, matrix_t& XT,
+                               std::vector<bool>& block_isnan) const;
+    /// Overwrite rhs with the solution x of AT*x == rhs, using the LU factors of AT
+    void                 substitute(matrix_t& rhs) const;
+    /// Residual R = AT*XT - BT, where promoted_BT is BT in the promoted scalar type, if used
+    void                 residual(const matrix_t& XT, const matrix_t& BT,
+                                  const promoted_matrix_t& promoted_BT, matrix_t& R) const;
+    /// Copy a matrix, converting its scalar type
+    template< typename To_Matrix_T, typename From_Matrix_T >
+    static void          convert(const From_Matrix_T& val, To_Matrix_T& result);
+
+    /// Divisor, within its frame
+    matrix_multi_t       m_val;
+    /// Transpose of the matrix of the divisor, AT
+    matrix_t             m_trans;
+    /// LU factors of AT
+    matrix_t             m_lu;
+    /// Row interchanges of the LU factorization
+    pivot_t              m_pivots;
+    /// LU factors of AT in the demoted scalar type, if used
+    demoted_matrix_t     m_demoted_lu;
+    /// AT in the promoted scalar type, if used
+    promoted_matrix_t    m_promoted_trans;
+    /// Is the divisor singular or NaN?
+    bool                 m_singular;
+    /// Are the LU factors held in m_demoted_lu?
+    bool                 m_demoted;
+  };
+
+  /// Geometric quotient by a factorized divisor
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  const matrix_multi<Scalar_T,LO,HI>
+  operator/ (const matrix_multi<Scalar_T,LO,HI>& lhs, const divisor<Scalar_T,LO,HI>& rhs);
+}
+#endif  // _GLUCAT_DIVISOR_H
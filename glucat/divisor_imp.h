@@ -0,0 +1,398 @@
+#ifndef _GLUCAT_DIVISOR_IMP_H
+#define _GLUCAT_DIVISOR_IMP_H
+/***************************************************************************
+    GluCat : Generic library of universal Clifford algebra templates
+    divisor_imp.h : Implement a class for repeated geometric quotients by one multivector
+                             -------------------
+    begin                : Sat 2026-10-17
+    copyright            : (C) 2001-2016 by Paul C. Leopardi
+ ***************************************************************************
+
+    This library is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published
+    by the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with this library.  If not, see <http://www.gnu.org/licenses/>.
+
+ ***************************************************************************
+ This library is based on a prototype written by Arvind Raja and was
+ licensed under the LGPL with permission of the author. See Arvind Raja,
+ "Object-oriented implementations of Clifford algebras in C++: a prototype",
+ in Ablamowicz, Lounesto and Parra (eds.)
+ "Clifford algebras with numeric and symbolic computations, Birkhauser, 1996."
+ ***************************************************************************
+ See also Arvind Raja's original header comments and references in glucat.h
+ ***************************************************************************/
+
+#include "glucat/divisor.h"
+
+namespace glucat
+{
+  /// Class name used in messages
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  const std::string
+  divisor<Scalar_T,LO,HI>::
+  classname()
+  { return "divisor"; }
+
+  /// Factorize val within its own frame
+  // To find X == B/A, we solve X*A == B <=> AT*XT == BT, so AT is factorized.
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  divisor<Scalar_T,LO,HI>::
+  divisor(const matrix_multi_t& val)
+  : m_val(val),
+    m_trans(ublas::trans(val.m_matrix)),
+    m_pivots(m_trans.size1()),
+    m_singular(true),
+    m_demoted(false)
+  {
+    typedef numeric_traits<demoted_scalar_t> demoted_traits_t;
+
+#if defined(_GLUCAT_CHECK_ISNAN)
+    if (val.isnan())
+      return;
+#endif
+    if (val == Scalar_T(0))
+      return;
+    if (Tune_P::div_residual_precision == precision_promoted)
+      convert(this->m_trans, this->m_promoted_trans);
+    if (Tune_P::div_factor_precision == precision_demoted)
+    {
+      // Use the demoted factors only if they are finite and non-singular,
+      // since AT may lie outside the range of the demoted scalar type.
+      convert(this->m_trans, this->m_demoted_lu);
+      this->m_demoted =
+        backend_t::lu_factorize(this->m_demoted_lu, this->m_pivots) == 0 &&
+        !demoted_traits_t::isNaN_or_isInf(backend_t::norm_inf(this->m_demoted_lu));
+      if (this->m_demoted)
+      {
+        this->m_singular = false;
+        return;
+      }
+      this->m_demoted_lu.resize(0, 0, false);
+      this->m_pivots = pivot_t(this->m_trans.size1());
+    }
+    this->m_lu = this->m_trans;
+    this->m_singular = (backend_t::lu_factorize(this->m_lu, this->m_pivots) != 0);
+  }
+
+  /// Frame of the divisor
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  inline
+  const index_set<LO,HI>
+  divisor<Scalar_T,LO,HI>::
+  frame() const
+  { return this->m_val.m_frame; }
+
+  /// Is the divisor singular, so that every quotient is NaN?
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  inline
+  bool
+  divisor<Scalar_T,LO,HI>::
+  is_singular() const
+  { return this->m_singular; }
+
+  /// Copy a matrix, converting its scalar type
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  template< typename To_Matrix_T, typename From_Matrix_T >
+  void
+  divisor<Scalar_T,LO,HI>::
+  convert(const From_Matrix_T& val, To_Matrix_T& result)
+  {
+    typedef typename To_Matrix_T::value_type to_scalar_t;
+    typedef typename From_Matrix_T::const_iterator1 const_iterator1;
+    typedef typename From_Matrix_T::const_iterator2 const_iterator2;
+
+    result.resize(val.size1(), val.size2(), false);
+    result.clear();
+    for (const_iterator1
+        val_it1 = val.begin1();
+        val_it1 != val.end1();
+        ++val_it1)
+      for (const_iterator2
+          val_it2 = val_it1.begin();
+          val_it2 != val_it1.end();
+          ++val_it2)
+        result(val_it2.index1(), val_it2.index2()) = numeric_traits<to_scalar_t>::to_scalar_t(*val_it2);
+  }
+
+  /// Overwrite rhs with the solution x of AT*x == rhs, using the LU factors of AT
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  void
+  divisor<Scalar_T,LO,HI>::
+  substitute(matrix_t& rhs) const
+  {
+    if (this->m_demoted)
+    {
+      demoted_matrix_t demoted_rhs;
+      convert(rhs, demoted_rhs);
+      backend_t::lu_substitute(this->m_demoted_lu, this->m_pivots, demoted_rhs);
+      convert(demoted_rhs, rhs);
+    }
+    else
+      backend_t::lu_substitute(this->m_lu, this->m_pivots, rhs);
+  }
+
+  /// Residual R = AT*XT - BT, where promoted_BT is BT in the promoted scalar type, if used
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  void
+  divisor<Scalar_T,LO,HI>::
+  residual(const matrix_t& XT, const matrix_t& BT,
+           const promoted_matrix_t& promoted_BT, matrix_t& R) const
+  {
+    if (Tune_P::div_residual_precision == precision_promoted)
+    {
+      // The residual is rounded to Scalar_T only after the subtraction.
+      promoted_matrix_t promoted_XT;
+      convert(XT, promoted_XT);
+      promoted_matrix_t promoted_R = -promoted_BT;
+      backend_t::prod(this->m_promoted_trans, promoted_XT, promoted_R, false);
+      convert(promoted_R, R);
+    }
+    else
+    {
+      // R = ublas::prod(AT, XT) - BT;
+      R = -BT;
+      backend_t::prod(this->m_trans, XT, R, false);
+    }
+  }
+
+  /// Solve AT*XT == BT, where BT holds nbr_blocks square blocks side by side
+  // Each block is refined separately, exactly as operator/ refines a single quotient,
+  // but each LU substitution and each product with AT is done once for all blocks.
+  // The factors may be demoted and the residual promoted, as selected by Tune_P.
+  // Reference: Nicholas J. Higham, "Accuracy and Stability of Numerical Algorithms",
+  // SIAM, 1996, ISBN 0-89871-355-2, Chapter 11
+  // Reference: Erin Carson and Nicholas J. Higham, "Accelerating the solution of
+  // linear systems by iterative refinement in three precisions",
+  // SIAM J. Sci. Comput. 40 (2), 2018, A817-A847
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  void
+  divisor<Scalar_T,LO,HI>::
+  solve(const matrix_t& BT, matrix_t& XT, std::vector<bool>& block_isnan) const
+  {
+    typedef numeric_traits<Scalar_T> traits_t;
+    typedef typename matrix_t::size_type matrix_index_t;
+    typedef ublas::range range_t;
+
+    const matrix_index_t dim = this->m_trans.size1();
+    const std::size_t nbr_blocks = block_isnan.size();
+    const range_t all_rows(0, dim);
+
+    XT = BT;
+    this->substitute(XT);
+#if defined(_GLUCAT_CHECK_ISNAN)
+    for (std::size_t
+        block = 0;
+        block != nbr_blocks;
+        ++block)
+      block_isnan[block] = matrix::isnan(ublas::project(XT, all_rows, range_t(block * dim, (block + 1) * dim)));
+#endif
+
+    // Iterative refinement.
+    if (Tune_P::div_max_steps > 0)
+    {
+      promoted_matrix_t promoted_BT;
+      if (Tune_P::div_residual_precision == precision_promoted)
+        convert(BT, promoted_BT);
+      matrix_t R;
+      this->residual(XT, BT, promoted_BT, R);
+
+      std::vector<Scalar_T> nr(nbr_blocks);
+      std::vector<Scalar_T> nrold(nbr_blocks);
+      std::vector<bool> active(nbr_blocks);
+      bool any_active = false;
+      for (std::size_t
+          block = 0;
+          block != nbr_blocks;
+          ++block)
+      {
+        const range_t cols(block * dim, (block + 1) * dim);
+#if defined(_GLUCAT_CHECK_ISNAN)
+        if (!block_isnan[block])
+          block_isnan[block] = matrix::isnan(ublas::project(R, all_rows, cols));
+#endif
+        nr[block] = backend_t::norm_inf(ublas::project(R, all_rows, cols));
+        nrold[block] = nr[block] + Scalar_T(1);
+        active[block] = !block_isnan[block]
+                     && nr[block] != Scalar_T(0)
+                     && !traits_t::isNaN_or_isInf(nr[block]);
+        any_active = any_active || active[block];
+      }
+      if (any_active)
+      {
+        matrix_t XTnew = XT;
+        for (int
+            step = 0;
+            step != Tune_P::div_max_steps;
+            ++step)
+        {
+          any_active = false;
+          for (std::size_t
+              block = 0;
+              block != nbr_blocks;
+              ++block)
+          {
+            active[block] = active[block] &&
+                            nr[block] < nrold[block] &&
+                            nr[block] != Scalar_T(0) &&
+                            nr[block] == nr[block];
+            if (active[block])
+            {
+              any_active = true;
+              nrold[block] = nr[block];
+              if (step != 0)
+              {
+                const range_t cols(block * dim, (block + 1) * dim);
+                ublas::project(XT, all_rows, cols) = ublas::project(XTnew, all_rows, cols);
+              }
+            }
+          }
+          if (!any_active)
+            break;
+          matrix_t& D = R;
+          this->substitute(D);
+          XTnew -= D;
+          this->residual(XTnew, BT, promoted_BT, R);
+          for (std::size_t
+              block = 0;
+              block != nbr_blocks;
+              ++block)
+            if (active[block])
+              nr[block] = backend_t::norm_inf(ublas::project(R, all_rows, range_t(block * dim, (block + 1) * dim)));
+        }
+      }
+    }
+  }
+
+  /// Geometric quotient lhs / val
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  const matrix_multi<Scalar_T,LO,HI>
+  divisor<Scalar_T,LO,HI>::
+  quotient(const matrix_multi_t& lhs) const
+  {
+    typedef numeric_traits<Scalar_T> traits_t;
+
+#if defined(_GLUCAT_CHECK_ISNAN)
+    if (lhs.isnan())
+      return traits_t::NaN();
+#endif
+    if (this->m_singular)
+      return traits_t::NaN();
+
+    // Operate only within a common frame
+    matrix_multi_t lhs_reframed;
+    matrix_multi_t val_reframed;
+    const index_set_t our_frame = reframe(lhs, this->m_val, lhs_reframed, val_reframed);
+    const matrix_multi_t& lhs_ref = (lhs.m_frame == our_frame)
+      ? lhs
+      : lhs_reframed;
+    if (our_frame != this->m_val.m_frame)
+      return divisor_t(val_reframed).quotient(lhs_ref);
+
+    const matrix_t& BT = ublas::trans(lhs_ref.m_matrix);
+    matrix_t XT;
+    std::vector<bool> block_isnan(1, false);
+    this->solve(BT, XT, block_isnan);
+    if (block_isnan[0])
+      return traits_t::NaN();
+    return matrix_multi_t(ublas::trans(XT), our_frame);
+  }
+
+  /// Geometric quotients of a batch: result[i] = lhs[i] / val
+  // The numerators within the frame of the divisor are solved together, as the
+  // blocks of one multi-column right hand side. result may be the same vector as lhs.
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  void
+  divisor<Scalar_T,LO,HI>::
+  quotient(const std::vector<matrix_multi_t>& lhs, std::vector<matrix_multi_t>& result) const
+  {
+    typedef numeric_traits<Scalar_T> traits_t;
+    typedef typename matrix_t::size_type matrix_index_t;
+    typedef ublas::range range_t;
+
+    const std::size_t nbr_lhs = lhs.size();
+    result.resize(nbr_lhs);
+    if (this->m_singular)
+    {
+      for (std::size_t
+          k = 0;
+          k != nbr_lhs;
+          ++k)
+        result[k] = traits_t::NaN();
+      return;
+    }
+
+    const index_set_t our_frame = this->m_val.m_frame;
+    const matrix_index_t dim = this->m_trans.size1();
+    const range_t all_rows(0, dim);
+    matrix_t BT(dim, dim * nbr_lhs);
+    std::vector<std::size_t> block_lhs;
+    block_lhs.reserve(nbr_lhs);
+    for (std::size_t
+        k = 0;
+        k != nbr_lhs;
+        ++k)
+    {
+      matrix_multi_t lhs_reframed;
+      matrix_multi_t val_reframed;
+      if (reframe(lhs[k], this->m_val, lhs_reframed, val_reframed) != our_frame
+#if defined(_GLUCAT_CHECK_ISNAN)
+       || lhs[k].isnan()
+#endif
+         )
+        result[k] = this->quotient(lhs[k]);
+      else
+      {
+        const matrix_multi_t& lhs_ref = (lhs[k].m_frame == our_frame)
+          ? lhs[k]
+          : lhs_reframed;
+        const std::size_t block = block_lhs.size();
+        ublas::project(BT, all_rows, range_t(block * dim, (block + 1) * dim)) = ublas::trans(lhs_ref.m_matrix);
+        block_lhs.push_back(k);
+      }
+    }
+    const std::size_t nbr_blocks = block_lhs.size();
+    if (nbr_blocks == 0)
+      return;
+    if (nbr_blocks != nbr_lhs)
+      BT.resize(dim, dim * nbr_blocks, true);
+
+    matrix_t XT;
+    std::vector<bool> block_isnan(nbr_blocks, false);
+    this->solve(BT, XT, block_isnan);
+    for (std::size_t
+        block = 0;
+        block != nbr_blocks;
+        ++block)
+      if (block_isnan[block])
+        result[block_lhs[block]] = traits_t::NaN();
+      else
+        result[block_lhs[block]] =
+          matrix_multi_t(ublas::trans(ublas::project(XT, all_rows, range_t(block * dim, (block + 1) * dim))),
+                         our_frame);
+  }
+
+  /// Clifford multiplicative inverse of val
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  inline
+  const matrix_multi<Scalar_T,LO,HI>
+  divisor<Scalar_T,LO,HI>::
+  inv() const
+  { return this->quotient(matrix_multi_t(Scalar_T(1), this->m_val.m_frame)); }
+
+  /// Geometric quotient by a factorized divisor
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  inline
+  const matrix_multi<Scalar_T,LO,HI>
+  operator/ (const matrix_multi<Scalar_T,LO,HI>& lhs, const divisor<Scalar_T,LO,HI>& rhs)
+  { return rhs.quotient(lhs); }
+}
+#endif  // _GLUCAT_DIVISOR_IMP_H
@@ -0,0 +1,298 @@
+#ifndef _GLUCAT_FIXED_MULTI_H
+#define _GLUCAT_FIXED_MULTI_H
+/***************************************************************************
+    GluCat : Generic library of universal Clifford algebra templates
+    fixed_multi.h : Declare a class for multivectors of a fixed signature
+                             -------------------
+    begin                : Sat 2026-10-17
+    copyright            : (C) 2001-2016 by Paul C. Leopardi
+ ***************************************************************************
+
+    This library is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published
+    by the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with this library.  If not, see <http://www.gnu.org/licenses/>.
+
+ ***************************************************************************
+ This library is based on a prototype written by Arvind Raja and was
+ licensed under the LGPL with permission of the author. See Arvind Raja,
+ "Object-oriented implementations of Clifford algebras in C++: a prototype",
+ in Ablamowicz, Lounesto and Parra (eds.)
+ "Clifford algebras with numeric and symbolic computations, Birkhauser, 1996."
+ ***************************************************************************
+ See also Arvind Raja's original header comments and references in glucat.h
+ ***************************************************************************/
+
+#include "glucat/global.h"
+#include "glucat/errors.h"
+#include "glucat/index_set.h"
+
+#include <boost/static_assert.hpp>
+
+#include <string>
+#include <ostream>
+
+namespace glucat
+{
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  class framed_multi; // forward
+
+  template< typename Scalar_T, const index_t P, const index_t Q, const index_t LO, const index_t HI >
+  class fixed_multi; // forward
+
+  /// Products which fixed_multi<> computes from its table of products of basis elements
+  enum fixed_product_t
+  {
+    fixed_geometric_product,
+    fixed_outer_product,
+    fixed_inner_product,
+    fixed_left_contraction
+  };
+
+  // Compile time table of products of basis elements.
+  // A basis element of Cl(P,Q) is given by the value of the fold of its index set
+  // within the frame {-Q,...,-1,1,...,P}, so bits 0 to Q-1 hold the negative indices.
+  // The sign of a product is found as in index_set<>::sign_of_mult(),
+  // but as a constant, so that each product can be unrolled into straight line code.
+  // The table uses static constants of class templates rather than constexpr functions,
+  // because configure compiles with -ansi (C++98) unless it selects C++11, that is,
+  // unless the map is stdunordered, or threads, the arena allocator or C++11 random are used.
+
+  /// Parity of the number of bits set in Val
+  template< set_value_t Val >
+  struct fixed_parity
+  { static const set_value_t value = (Val & 1) ^ fixed_parity<(Val >> 1)>::value; };
+
+  template< >
+  struct fixed_parity<0>
+  { static const set_value_t value = 0; };
+
+  /// Inverse reversed Gray code of Val: each bit is the parity of the same and lower bits of Val
+  template< set_value_t Val >
+  struct fixed_prefix_parity
+  {
+    // Each bit set in Val flips that bit and all higher bits
+    static const set_value_t value =
+      ~((Val & (set_value_t(0) - Val)) - 1) ^ fixed_prefix_parity<(Val & (Val - 1))>::value;
+  };
+
+  template< >
+  struct fixed_prefix_parity<0>
+  { static const set_value_t value = 0; };
+
+  /// Sign of the geometric product of the basis elements J and K of Cl(P,Q)
+  template< const index_t Q, set_value_t J, set_value_t K >
+  struct fixed_sign_of_mult
+  {
+    static const int value =
+      1 - 2 * int(fixed_parity<(J & fixed_prefix_parity<K>::value)>::value
+                ^ fixed_parity<((J & K) >> Q)>::value);
+  };
+
+  /// Does the product include the product of the basis elements J and K?
+  template< int Product, set_value_t J, set_value_t K >
+  struct fixed_product_has_term
+  {
+    static const bool value =
+         (Product == fixed_geometric_product)
+      || (Product == fixed_outer_product    && (J & K) == 0)
+      || (Product == fixed_inner_product    && J != 0 && K != 0 && ((J & K) == J || (J & K) == K))
+      || (Product == fixed_left_contraction && (J & K) == J);
+  };
+
+  /// Add the products of basis element J with basis elements K to Dim-1, unrolled
+  template< int Product, const index_t Q, set_value_t Dim, set_value_t J, set_value_t K >
+  struct fixed_product_row
+  {
+    template< typename Scalar_T >
+    static void add(const Scalar_T* lhs, const Scalar_T* rhs, Scalar_T* result)
+    {
+      if (fixed_product_has_term<Product, J, K>::value)
+        result[J ^ K] += Scalar_T(fixed_sign_of_mult<Q, J, K>::value) * lhs[J] * rhs[K];
+      fixed_product_row<Product, Q, Dim, J, K + 1>::add(lhs, rhs, result);
+    }
+  };
+
+  template< int Product, const index_t Q, set_value_t Dim, set_value_t J >
+  struct fixed_product_row<Product, Q, Dim, J, Dim>
+  {
+    template< typename Scalar_T >
+    static void add(const Scalar_T*, const Scalar_T*, Scalar_T*)
+    { }
+  };
+
+  /// Add the products of basis elements J to Dim-1 with all basis elements, unrolled
+  template< int Product, const index_t Q, set_value_t Dim, set_value_t J >
+  struct fixed_product_rows
+  {
+    template< typename Scalar_T >
+    static void add(const Scalar_T* lhs, const Scalar_T* rhs, Scalar_T* result)
+    {
+      fixed_product_row<Product, Q, Dim, J, 0>::add(lhs, rhs, result);
+      fixed_product_rows<Product, Q, Dim, J + 1>::add(lhs, rhs, result);
+    }
+  };
+
+  template< int Product, const index_t Q, set_value_t Dim >
+  struct fixed_product_rows<Product, Q, Dim, Dim>
+  {
+    template< typename Scalar_T >
+    static void add(const Scalar_T*, const Scalar_T*, Scalar_T*)
+    { }
+  };
+
+  /// Geometric product
+  template< typename Scalar_T, const index_t P, const index_t Q, const index_t LO, const index_t HI >
+  const fixed_multi<Scalar_T,P,Q,LO,HI>
+  operator* (const fixed_multi<Scalar_T,P,Q,LO,HI>& lhs, const fixed_multi<Scalar_T,P,Q,LO,HI>& rhs);
+
+  /// Outer product
+  template< typename Scalar_T, const index_t P, const index_t Q, const index_t LO, const index_t HI >
+  const fixed_multi<Scalar_T,P,Q,LO,HI>
+  operator^ (const fixed_multi<Scalar_T,P,Q,LO,HI>& lhs, const fixed_multi<Scalar_T,P,Q,LO,HI>& rhs);
+
+  /// Inner product
+  template< typename Scalar_T, const index_t P, const index_t Q, const index_t LO, const index_t HI >
+  const fixed_multi<Scalar_T,P,Q,LO,HI>
+  operator& (const fixed_multi<Scalar_T,P,Q,LO,HI>& lhs, const fixed_multi<Scalar_T,P,Q,LO,HI>& rhs);
+
+  /// Left contraction
+  template< typename Scalar_T, const index_t P, const index_t Q, const index_t LO, const index_t HI >
+  const fixed_multi<Scalar_T,P,Q,LO,HI>
+  operator% (const fixed_multi<Scalar_T,P,Q,LO,HI>& lhs, const fixed_multi<Scalar_T,P,Q,LO,HI>& rhs);
+
+  /// A fixed_multi<Scalar_T,P,Q> is a multivector of the real Clifford algebra Cl(P,Q).
+  // Usage:
+  //   typedef fixed_multi<double,3,1> cl31_t;
+  //   const cl31_t c = a * b;
+  //   const cl31_t e = cl31_t(exp(c.framed()));
+  // The coordinates are held in an array, indexed by the value of the fold of
+  // each index set within the frame {-Q,...,-1,1,...,P}, and each product is
+  // unrolled at compile time from the table of products of basis elements.
+  // Unrolling gives 4^(P+Q) terms, so P+Q is limited to 6.
+  // Other operations, such as the transcendental functions, use framed_multi<>
+  // by means of framed() and the constructor from framed_multi<>.
+  template< typename Scalar_T, const index_t P, const index_t Q,
+            const index_t LO = DEFAULT_LO, const index_t HI = DEFAULT_HI >
+  class fixed_multi
+  {
+  private:
+    BOOST_STATIC_ASSERT((0 <= P) && (0 <= Q) && (P + Q <= 6) &&
+                        (Q <= -LO) && (P <= HI));
+  public:
+    typedef fixed_multi                                multivector_t;
+    typedef Scalar_T                                   scalar_t;
+    typedef index_set<LO,HI>                           index_set_t;
+    typedef framed_multi<Scalar_T,LO,HI>               framed_multi_t;
+    typedef error<multivector_t>                       error_t;
+
+    /// Number of coordinates
+    static const set_value_t dim = set_value_t(1) << (P + Q);
+
+    /// Class name used in messages
+    static const std::string classname();
+    /// Frame of the algebra: {-Q,...,-1,1,...,P}
+    static const index_set_t frame();
+
+    /// Default constructor: zero
+    fixed_multi();
+    /// Construct a multivector from a scalar
+    fixed_multi(const Scalar_T& scr);
+    /// Construct a multivector from an int
+    fixed_multi(const int scr);
+    /// Construct a multivector from an index set and a scalar coordinate
+    fixed_multi(const index_set_t ist, const Scalar_T& crd = Scalar_T(1));
+    /// Construct a multivector from a framed_multi_t, which must lie within frame()
+    fixed_multi(const framed_multi_t& val);
+    /// Value as a framed_multi_t
+    const framed_multi_t framed() const;
+
+    /// Test for equality of multivectors
+    bool                 operator== (const multivector_t& rhs) const;
+    /// Test for inequality of multivectors
+    bool                 operator!= (const multivector_t& rhs) const;
+    /// Subscripting: map from index set to scalar coordinate
+    Scalar_T             operator[] (const index_set_t ist) const;
+    /// Scalar part
+    Scalar_T             scalar() const;
+    /// Scalar_T norm == sum of squares of coordinates
+    Scalar_T             norm() const;
+
+    /// Unary -
+    const multivector_t  operator- () const;
+    /// Sum
+    multivector_t&       operator+= (const multivector_t& rhs);
+    /// Difference
+    multivector_t&       operator-= (const multivector_t& rhs);
+    /// Product of multivector and scalar
+    multivector_t&       operator*= (const Scalar_T& scr);
+    /// Quotient of multivector and scalar
+    multivector_t&       operator/= (const Scalar_T& scr);
+    /// Geometric product
+    multivector_t&       operator*= (const multivector_t& rhs);
+    /// Outer product
+    multivector_t&       operator^= (const multivector_t& rhs);
+    /// Inner product
+    multivector_t&       operator&= (const multivector_t& rhs);
+    /// Left contraction
+    multivector_t&       operator%= (const multivector_t& rhs);
+
+    // Friend declarations
+
+    friend const multivector_t
+      operator* <>(const multivector_t& lhs, const multivector_t& rhs);
+    friend const multivector_t
+      operator^ <>(const multivector_t& lhs, const multivector_t& rhs);
+    friend const multivector_t
+      operator& <>(const multivector_t& lhs, const multivector_t& rhs);
+    friend const multivector_t
+      operator% <>(const multivector_t& lhs, const multivector_t& rhs);
+
+  private:
+    /// Product of lhs and rhs, using the unrolled table of products of basis elements
+    template< int Product >
+    static const multivector_t product(const multivector_t& lhs, const multivector_t& rhs);
+
+    /// Coordinates, indexed by the value of the fold of each index set within frame()
+    Scalar_T m_crd[dim];
+  };
+
+  /// Sum
+  template< typename Scalar_T, const index_t P, const index_t Q, const index_t LO, const index_t HI >
+  const fixed_multi<Scalar_T,P,Q,LO,HI>
+  operator+ (const fixed_multi<Scalar_T,P,Q,LO,HI>& lhs, const fixed_multi<Scalar_T,P,Q,LO,HI>& rhs);
+
+  /// Difference
+  template< typename Scalar_T, const index_t P, const index_t Q, const index_t LO, const index_t HI >
+  const fixed_multi<Scalar_T,P,Q,LO,HI>
+  operator- (const fixed_multi<Scalar_T,P,Q,LO,HI>& lhs, const fixed_multi<Scalar_T,P,Q,LO,HI>& rhs);
+
+  /// Product of multivector and scalar
+  template< typename Scalar_T, const index_t P, const index_t Q, const index_t LO, const index_t HI >
+  const fixed_multi<Scalar_T,P,Q,LO,HI>
+  operator* (const fixed_multi<Scalar_T,P,Q,LO,HI>& lhs, const Scalar_T& scr);
+
+  /// Product of scalar and multivector
+  template< typename Scalar_T, const index_t P, const index_t Q, const index_t LO, const index_t HI >
+  const fixed_multi<Scalar_T,P,Q,LO,HI>
+  operator* (const Scalar_T& scr, const fixed_multi<Scalar_T,P,Q,LO,HI>& rhs);
+
+  /// Quotient of multivector and scalar
+  template< typename Scalar_T, const index_t P, const index_t Q, const index_t LO, const index_t HI >
+  const fixed_multi<Scalar_T,P,Q,LO,HI>
+  operator/ (const fixed_multi<Scalar_T,P,Q,LO,HI>& lhs, const Scalar_T& scr);
+
+  /// Write multivector to output
+  template< typename Scalar_T, const index_t P, const index_t Q, const index_t LO, const index_t HI >
+  std::ostream&
+  operator<< (std::ostream& os, const fixed_multi<Scalar_T,P,Q,LO,HI>& val);
+}
+#endif  // _GLUCAT_FIXED_MULTI_H
@@ -0,0 +1,415 @@
+#ifndef _GLUCAT_FIXED_MULTI_IMP_H
+#define _GLUCAT_FIXED_MULTI_IMP_H
+/***************************************************************************
+    GluCat : Generic library of universal Clifford algebra templates
+    fixed_multi_imp.h : Implement the class for multivectors of a fixed signature
+                             -------------------
+    begin                : Sat 2026-10-17
+    copyright            : (C) 2001-2016 by Paul C. Leopardi
+ ***************************************************************************
+
+    This library is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published
+    by the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with this library.  If not, see <http://www.gnu.org/licenses/>.
+
+ ***************************************************************************
+ This library is based on a prototype written by Arvind Raja and was
+ licensed under the LGPL with permission of the author. See Arvind Raja,
+ "Object-oriented implementations of Clifford algebras in C++: a prototype",
+ in Ablamowicz, Lounesto and Parra (eds.)
+ "Clifford algebras with numeric and symbolic computations, Birkhauser, 1996."
+ ***************************************************************************
+ See also Arvind Raja's original header comments and references in glucat.h
+ ***************************************************************************/
+
+#include "glucat/fixed_multi.h"
+
+#include <sstream>
+
+namespace glucat
+{
+  /// Class name used in messages
+  template< typename Scalar_T, const index_t P, const index_t Q, const index_t LO, const index_t HI >
+  const std::string
+  fixed_multi<Scalar_T,P,Q,LO,HI>::
+  classname()
+  {
+    std::ostringstream os;
+    os << "fixed_multi<" << P << "," << Q << ">";
+    return os.str();
+  }
+
+  /// Frame of the algebra: {-Q,...,-1,1,...,P}
+  template< typename Scalar_T, const index_t P, const index_t Q, const index_t LO, const index_t HI >
+  const index_set<LO,HI>
+  fixed_multi<Scalar_T,P,Q,LO,HI>::
+  frame()
+  {
+    index_set_t result;
+    if (Q > 0)
+      result |= index_set_t(std::make_pair(index_t(-Q), index_t(-1)));
+    if (P > 0)
+      result |= index_set_t(std::make_pair(index_t(1), index_t(P)));
+    return result;
+  }
+
+  /// Default constructor: zero
+  template< typename Scalar_T, const index_t P, const index_t Q, const index_t LO, const index_t HI >
+  fixed_multi<Scalar_T,P,Q,LO,HI>::
+  fixed_multi()
+  {
+    for (set_value_t
+        stv = 0;
+        stv != dim;
+        ++stv)
+      this->m_crd[stv] = Scalar_T(0);
+  }
+
+  /// Construct a multivector from a scalar
+  template< typename Scalar_T, const index_t P, const index_t Q, const index_t LO, const index_t HI >
+  fixed_multi<Scalar_T,P,Q,LO,HI>::
+  fixed_multi(const Scalar_T& scr)
+  {
+    this->m_crd[0] = scr;
+    for (set_value_t
+        stv = 1;
+        stv != dim;
+        ++stv)
+      this->m_crd[stv] = Scalar_T(0);
+  }
+
+  /// Construct a multivector from an int
+  template< typename Scalar_T, const index_t P, const index_t Q, const index_t LO, const index_t HI >
+  fixed_multi<Scalar_T,P,Q,LO,HI>::
+  fixed_multi(const int scr)
+  { *this = multivector_t(Scalar_T(scr)); }
+
+  /// Construct a multivector from an index set and a scalar coordinate
+  template< typename Scalar_T, const index_t P, const index_t Q, const index_t LO, const index_t HI >
+  fixed_multi<Scalar_T,P,Q,LO,HI>::
+  fixed_multi(const index_set_t ist, const Scalar_T& crd)
+  {
+    const index_set_t frm = frame();
+    if ((ist | frm) != frm)
+      throw error_t("multivector_t(ist,crd): cannot construct value outside of frame");
+    for (set_value_t
+        stv = 0;
+        stv != dim;
+        ++stv)
+      this->m_crd[stv] = Scalar_T(0);
+    this->m_crd[ist.value_of_fold(frm)] = crd;
+  }
+
+  /// Construct a multivector from a framed_multi_t, which must lie within frame()
+  template< typename Scalar_T, const index_t P, const index_t Q, const index_t LO, const index_t HI >
+  fixed_multi<Scalar_T,P,Q,LO,HI>::
+  fixed_multi(const framed_multi_t& val)
+  {
+    const index_set_t frm = frame();
+    if ((val.frame() | frm) != frm)
+      throw error_t("multivector_t(val): cannot construct value outside of frame");
+    for (set_value_t
+        stv = 0;
+        stv != dim;
+        ++stv)
+      this->m_crd[stv] = Scalar_T(0);
+    typedef typename framed_multi_t::const_iterator const_iterator;
+    const const_iterator val_end = val.end();
+    for (const_iterator
+        val_it = val.begin();
+        val_it != val_end;
+        ++val_it)
+      this->m_crd[val_it->first.value_of_fold(frm)] = val_it->second;
+  }
+
+  /// Value as a framed_multi_t
+  template< typename Scalar_T, const index_t P, const index_t Q, const index_t LO, const index_t HI >
+  const framed_multi<Scalar_T,LO,HI>
+  fixed_multi<Scalar_T,P,Q,LO,HI>::
+  framed() const
+  {
+    typedef typename framed_multi_t::term_t term_t;
+    const index_set_t frm = frame();
+    framed_multi_t result;
+    for (set_value_t
+        stv = 0;
+        stv != dim;
+        ++stv)
+      if (this->m_crd[stv] != Scalar_T(0))
+        result += term_t(index_set_t(stv, frm, true), this->m_crd[stv]);
+    return result;
+  }
+
+  /// Test for equality of multivectors
+  template< typename Scalar_T, const index_t P, const index_t Q, const index_t LO, const index_t HI >
+  bool
+  fixed_multi<Scalar_T,P,Q,LO,HI>::
+  operator== (const multivector_t& rhs) const
+  {
+    for (set_value_t
+        stv = 0;
+        stv != dim;
+        ++stv)
+      if (this->m_crd[stv] != rhs.m_crd[stv])
+        return false;
+    return true;
+  }
+
+  /// Test for inequality of multivectors
+  template< typename Scalar_T, const index_t P, const index_t Q, const index_t LO, const index_t HI >
+  inline
+  bool
+  fixed_multi<Scalar_T,P,Q,LO,HI>::
+  operator!= (const multivector_t& rhs) const
+  { return !(*this == rhs); }
+
+  /// Subscripting: map from index set to scalar coordinate
+  template< typename Scalar_T, const index_t P, const index_t Q, const index_t LO, const index_t HI >
+  Scalar_T
+  fixed_multi<Scalar_T,P,Q,LO,HI>::
+  operator[] (const index_set_t ist) const
+  {
+    const index_set_t frm = frame();
+    return ((ist | frm) == frm)
+         ? this->m_crd[ist.value_of_fold(frm)]
+         : Scalar_T(0);
+  }
+
+  /// Scalar part
+  template< typename Scalar_T, const index_t P, const index_t Q, const index_t LO, const index_t HI >
+  inline
+  Scalar_T
+  fixed_multi<Scalar_T,P,Q,LO,HI>::
+  scalar() const
+  { return this->m_crd[0]; }
+
+  /// Scalar_T norm == sum of squares of coordinates
+  template< typename Scalar_T, const index_t P, const index_t Q, const index_t LO, const index_t HI >
+  Scalar_T
+  fixed_multi<Scalar_T,P,Q,LO,HI>::
+  norm() const
+  {
+    Scalar_T result = Scalar_T(0);
+    for (set_value_t
+        stv = 0;
+        stv != dim;
+        ++stv)
+      result += this->m_crd[stv] * this->m_crd[stv];
+    return result;
+  }
+
+  /// Unary -
+  template< typename Scalar_T, const index_t P, const index_t Q, const index_t LO, const index_t HI >
+  const fixed_multi<Scalar_T,P,Q,LO,HI>
+  fixed_multi<Scalar_T,P,Q,LO,HI>::
+  operator- () const
+  { return *this * Scalar_T(-1); }
+
+  /// Sum
+  template< typename Scalar_T, const index_t P, const index_t Q, const index_t LO, const index_t HI >
+  fixed_multi<Scalar_T,P,Q,LO,HI>&
+  fixed_multi<Scalar_T,P,Q,LO,HI>::
+  operator+= (const multivector_t& rhs)
+  {
+    for (set_value_t
+        stv = 0;
+        stv != dim;
+        ++stv)
+      this->m_crd[stv] += rhs.m_crd[stv];
+    return *this;
+  }
+
+  /// Difference
+  template< typename Scalar_T, const index_t P, const index_t Q, const index_t LO, const index_t HI >
+  fixed_multi<Scalar_T,P,Q,LO,HI>&
+  fixed_multi<Scalar_T,P,Q,LO,HI>::
+  operator-= (const multivector_t& rhs)
+  {
+    for (set_value_t
+        stv = 0;
+        stv != dim;
+        ++stv)
+      this->m_crd[stv] -= rhs.m_crd[stv];
+    return *this;
+  }
+
+  /// Product of multivector and scalar
+  template< typename Scalar_T, const index_t P, const index_t Q, const index_t LO, const index_t HI >
+  fixed_multi<Scalar_T,P,Q,LO,HI>&
+  fixed_multi<Scalar_T,P,Q,LO,HI>::
+  operator*= (const Scalar_T& scr)
+  {
+    for (set_value_t
+        stv = 0;
+        stv != dim;
+        ++stv)
+      this->m_crd[stv] *= scr;
+    return *this;
+  }
+
+  /// Quotient of multivector and scalar
+  template< typename Scalar_T, const index_t P, const index_t Q, const index_t LO, const index_t HI >
+  fixed_multi<Scalar_T,P,Q,LO,HI>&
+  fixed_multi<Scalar_T,P,Q,LO,HI>::
+  operator/= (const Scalar_T& scr)
+  {
+    for (set_value_t
+        stv = 0;
+        stv != dim;
+        ++stv)
+      this->m_crd[stv] /= scr;
+    return *this;
+  }
+
+  /// Product of lhs and rhs, using the unrolled table of products of basis elements
+  template< typename Scalar_T, const index_t P, const index_t Q, const index_t LO, const index_t HI >
+  template< int Product >
+  inline
+  const fixed_multi<Scalar_T,P,Q,LO,HI>
+  fixed_multi<Scalar_T,P,Q,LO,HI>::
+  product(const multivector_t& lhs, const multivector_t& rhs)
+  {
+    multivector_t result;
+    fixed_product_rows<Product, Q, dim, 0>::add(lhs.m_crd, rhs.m_crd, result.m_crd);
+    return result;
+  }
+
+  /// Geometric product
+  template< typename Scalar_T, const index_t P, const index_t Q, const index_t LO, const index_t HI >
+  inline
+  fixed_multi<Scalar_T,P,Q,LO,HI>&
+  fixed_multi<Scalar_T,P,Q,LO,HI>::
+  operator*= (const multivector_t& rhs)
+  { return *this = *this * rhs; }
+
+  /// Outer product
+  template< typename Scalar_T, const index_t P, const index_t Q, const index_t LO, const index_t HI >
+  inline
+  fixed_multi<Scalar_T,P,Q,LO,HI>&
+  fixed_multi<Scalar_T,P,Q,LO,HI>::
+  operator^= (const multivector_t& rhs)
+  { return *this = *this ^ rhs; }
+
+  /// Inner product
+  template< typename Scalar_T, const index_t P, const index_t Q, const index_t LO, const index_t HI >
+  inline
+  fixed_multi<Scalar_T,P,Q,LO,HI>&
+  fixed_multi<Scalar_T,P,Q,LO,HI>::
+  operator&= (const multivector_t& rhs)
+  { return *this = *this & rhs; }
+
+  /// Left contraction
+  template< typename Scalar_T, const index_t P, const index_t Q, const index_t LO, const index_t HI >
+  inline
+  fixed_multi<Scalar_T,P,Q,LO,HI>&
+  fixed_multi<Scalar_T,P,Q,LO,HI>::
+  operator%= (const multivector_t& rhs)
+  { return *this = *this % rhs; }
+
+  /// Geometric product
+  template< typename Scalar_T, const index_t P, const index_t Q, const index_t LO, const index_t HI >
+  inline
+  const fixed_multi<Scalar_T,P,Q,LO,HI>
+  operator* (const fixed_multi<Scalar_T,P,Q,LO,HI>& lhs, const fixed_multi<Scalar_T,P,Q,LO,HI>& rhs)
+  {
+    typedef fixed_multi<Scalar_T,P,Q,LO,HI> multivector_t;
+    return multivector_t::template product<fixed_geometric_product>(lhs, rhs);
+  }
+
+  /// Outer product
+  template< typename Scalar_T, const index_t P, const index_t Q, const index_t LO, const index_t HI >
+  inline
+  const fixed_multi<Scalar_T,P,Q,LO,HI>
+  operator^ (const fixed_multi<Scalar_T,P,Q,LO,HI>& lhs, const fixed_multi<Scalar_T,P,Q,LO,HI>& rhs)
+  {
+    typedef fixed_multi<Scalar_T,P,Q,LO,HI> multivector_t;
+    return multivector_t::template product<fixed_outer_product>(lhs, rhs);
+  }
+
+  /// Inner product
+  template< typename Scalar_T, const index_t P, const index_t Q, const index_t LO, const index_t HI >
+  inline
+  const fixed_multi<Scalar_T,P,Q,LO,HI>
+  operator& (const fixed_multi<Scalar_T,P,Q,LO,HI>& lhs, const fixed_multi<Scalar_T,P,Q,LO,HI>& rhs)
+  {
+    typedef fixed_multi<Scalar_T,P,Q,LO,HI> multivector_t;
+    return multivector_t::template product<fixed_inner_product>(lhs, rhs);
+  }
+
+  /// Left contraction
+  template< typename Scalar_T, const index_t P, const index_t Q, const index_t LO, const index_t HI >
+  inline
+  const fixed_multi<Scalar_T,P,Q,LO,HI>
+  operator% (const fixed_multi<Scalar_T,P,Q,LO,HI>& lhs, const fixed_multi<Scalar_T,P,Q,LO,HI>& rhs)
+  {
+    typedef fixed_multi<Scalar_T,P,Q,LO,HI> multivector_t;
+    return multivector_t::template product<fixed_left_contraction>(lhs, rhs);
+  }
+
+  /// Sum
+  template< typename Scalar_T, const index_t P, const index_t Q, const index_t LO, const index_t HI >
+  inline
+  const fixed_multi<Scalar_T,P,Q,LO,HI>
+  operator+ (const fixed_multi<Scalar_T,P,Q,LO,HI>& lhs, const fixed_multi<Scalar_T,P,Q,LO,HI>& rhs)
+  {
+    fixed_multi<Scalar_T,P,Q,LO,HI> result = lhs;
+    return result += rhs;
+  }
+
+  /// Difference
+  template< typename Scalar_T, const index_t P, const index_t Q, const index_t LO, const index_t HI >
+  inline
+  const fixed_multi<Scalar_T,P,Q,LO,HI>
+  operator- (const fixed_multi<Scalar_T,P,Q,LO,HI>& lhs, const fixed_multi<Scalar_T,P,Q,LO,HI>& rhs)
+  {
+    fixed_multi<Scalar_T,P,Q,LO,HI> result = lhs;
+    return result -= rhs;
+  }
+
+  /// Product of multivector and scalar
+  template< typename Scalar_T, const index_t P, const index_t Q, const index_t LO, const index_t HI >
+  inline
+  const fixed_multi<Scalar_T,P,Q,LO,HI>
+  operator* (const fixed_multi<Scalar_T,P,Q,LO,HI>& lhs, const Scalar_T& scr)
+  {
+    fixed_multi<Scalar_T,P,Q,LO,HI> result = lhs;
+    return result *= scr;
+  }
+
+  /// Product of scalar and multivector
+  template< typename Scalar_T, const index_t P, const index_t Q, const index_t LO, const index_t HI >
+  inline
+  const fixed_multi<Scalar_T,P,Q,LO,HI>
+  operator* (const Scalar_T& scr, const fixed_multi<Scalar_T,P,Q,LO,HI>& rhs)
+  {
+    fixed_multi<Scalar_T,P,Q,LO,HI> result = rhs;
+    return result *= scr;
+  }
+
+  /// Quotient of multivector and scalar
+  template< typename Scalar_T, const index_t P, const index_t Q, const index_t LO, const index_t HI >
+  inline
+  const fixed_multi<Scalar_T,P,Q,LO,HI>
+  operator/ (const fixed_multi<Scalar_T,P,Q,LO,HI>& lhs, const Scalar_T& scr)
+  {
+    fixed_multi<Scalar_T,P,Q,LO,HI> result = lhs;
+    return result /= scr;
+  }
+
+  /// Write multivector to output
+  template< typename Scalar_T, const index_t P, const index_t Q, const index_t LO, const index_t HI >
+  inline
+  std::ostream&
+  operator<< (std::ostream& os, const fixed_multi<Scalar_T,P,Q,LO,HI>& val)
+  { return os << val.framed(); }
+}
+#endif  // _GLUCAT_FIXED_MULTI_IMP_H
@@ -0,0 +1,249 @@
+#ifndef _GLUCAT_FLAT_MAP_H
+#define _GLUCAT_FLAT_MAP_H
+/***************************************************************************
+    GluCat : Generic library of universal Clifford algebra templates
+    flat_map.h : Sorted map stored as a contiguous array of terms
+                             -------------------
+    begin                : Sat 2026-10-17
+    copyright            : (C) 2001-2016 by Paul C. Leopardi
+ ***************************************************************************
+
+    This library is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published
+    by the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with this library.  If not, see <http://www.gnu.org/licenses/>.
+
+ ***************************************************************************
+ This library is based on a prototype written by Arvind Raja and was
+ licensed under the LGPL with permission of the author. See Arvind Raja,
+ "Object-oriented implementations of Clifford algebras in C++: a prototype",
+ in Ablamowicz, Lounesto and Parra (eds.)
+ "Clifford algebras with numeric and symbolic computations, Birkhauser, 1996."
+ ***************************************************************************
+ See also Arvind Raja's original header comments and references in glucat.h
+ ***************************************************************************/
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace glucat
+{
+  /// Sorted map stored as a contiguous array of (key, value) pairs.
+  // Provides the subset of the std::map<> interface used by framed_multi<>,
+  // plus push_back() and sort_and_merge(), which let products append terms
+  // in any order and then sort and combine them in one pass.
+  // The pairs are stored as std::pair<Key, T>, with a mutable key, so that the array
+  // can be sorted, and the iterators are those of the array, referring to the stored pairs.
+  // The key of a pair must not be modified through an iterator.
+  template< typename Key, typename T, typename Compare = std::less<Key> >
+  class flat_map
+  {
+  public:
+    typedef Key                                        key_type;
+    typedef T                                          mapped_type;
+    typedef std::pair<Key, T>                          value_type;
+    typedef Compare                                    key_compare;
+    typedef std::size_t                                size_type;
+    typedef std::ptrdiff_t                             difference_type;
+    typedef value_type&                                reference;
+    typedef const value_type&                          const_reference;
+
+  private:
+    typedef std::vector<value_type>                    array_t;
+
+    /// Compare the keys of two stored pairs
+    class stored_less
+    {
+    public:
+      bool operator()(const value_type& lhs, const value_type& rhs) const
+      { return key_compare()(lhs.first, rhs.first); }
+    };
+
+  public:
+    typedef typename array_t::iterator                 iterator;
+    typedef typename array_t::const_iterator           const_iterator;
+    typedef std::reverse_iterator<iterator>            reverse_iterator;
+    typedef std::reverse_iterator<const_iterator>      const_reverse_iterator;
+
+  public:
+    /// Default constructor
+    flat_map()
+    : m_sorted_size(0)
+    { }
+
+    iterator               begin()
+    { return m_array.begin(); }
+    const_iterator         begin() const
+    { return m_array.begin(); }
+    iterator               end()
+    { return m_array.end(); }
+    const_iterator         end() const
+    { return m_array.end(); }
+    reverse_iterator       rbegin()
+    { return reverse_iterator(end()); }
+    const_reverse_iterator rbegin() const
+    { return const_reverse_iterator(end()); }
+    reverse_iterator       rend()
+    { return reverse_iterator(begin()); }
+    const_reverse_iterator rend() const
+    { return const_reverse_iterator(begin()); }
+
+    size_type size() const
+    { return m_array.size(); }
+    bool      empty() const
+    { return m_array.empty(); }
+    void      clear()
+    {
+      m_array.clear();
+      m_sorted_size = 0;
+    }
+    void      reserve(const size_type n)
+    { m_array.reserve(n); }
+    void      swap(flat_map& other)
+    {
+      m_array.swap(other.m_array);
+      std::swap(m_sorted_size, other.m_sorted_size);
+    }
+
+    /// First pair whose key is not less than key
+    iterator       lower_bound(const key_type& key)
+    { return begin() + (lower_bound_pos(key)); }
+    const_iterator lower_bound(const key_type& key) const
+    { return begin() + (lower_bound_pos(key)); }
+    /// First pair whose key is greater than key
+    iterator       upper_bound(const key_type& key)
+    { return begin() + (upper_bound_pos(key)); }
+    const_iterator upper_bound(const key_type& key) const
+    { return begin() + (upper_bound_pos(key)); }
+
+    /// Find the pair with the given key, using binary search
+    iterator       find(const key_type& key)
+    {
+      const iterator it = lower_bound(key);
+      return (it == end() || key_compare()(key, it->first)) ? end() : it;
+    }
+    const_iterator find(const key_type& key) const
+    {
+      const const_iterator it = lower_bound(key);
+      return (it == end() || key_compare()(key, it->first)) ? end() : it;
+    }
+
+    /// Insert a pair if its key is not already present
+    std::pair<iterator, bool> insert(const value_type& val)
+    {
+      // Pairs appended by push_back() may include the key
+      sort_and_merge();
+      // Appending in increasing order of key is the common case
+      if (m_array.empty() || key_compare()(m_array.back().first, val.first))
+      {
+        m_array.push_back(val);
+        m_sorted_size = m_array.size();
+        return std::make_pair(end() - 1, true);
+      }
+      const size_type pos = lower_bound_pos(val.first);
+      if (!key_compare()(val.first, m_array[pos].first))
+        return std::make_pair(begin() + pos, false);
+      m_array.insert(m_array.begin() + pos, val);
+      m_sorted_size = m_array.size();
+      return std::make_pair(begin() + pos, true);
+    }
+
+    /// Erase the pair at the given position
+    void erase(iterator pos)
+    {
+      // Erasing a pair keeps the order of the others, sorted or appended
+      if (size_type(pos - begin()) < m_sorted_size)
+        --m_sorted_size;
+      m_array.erase(pos);
+    }
+
+    /// Append a pair without checking order or uniqueness: call sort_and_merge() before any lookup
+    void push_back(const value_type& val)
+    { m_array.push_back(val); }
+
+    /// Sort the appended pairs, add values with equal keys, in order, and drop zero values
+    void sort_and_merge()
+    {
+      typedef typename array_t::iterator array_iterator;
+      const array_iterator array_begin  = m_array.begin();
+      const array_iterator array_sorted = array_begin + m_sorted_size;
+      const array_iterator array_end    = m_array.end();
+      if (array_sorted == array_end)
+        return;
+      std::stable_sort(array_sorted, array_end, stored_less());
+      std::inplace_merge(array_begin, array_sorted, array_end, stored_less());
+
+      array_iterator result_it = array_begin;
+      for (array_iterator
+          array_it = array_begin;
+          array_it != array_end;
+          )
+      {
+        value_type term = *array_it;
+        for (++array_it;
+            array_it != array_end && !key_compare()(term.first, array_it->first);
+            ++array_it)
+          term.second += array_it->second;
+        if (term.second != T(0))
+          *result_it++ = term;
+      }
+      m_array.erase(result_it, array_end);
+      m_sorted_size = m_array.size();
+    }
+
+  private:
+    size_type lower_bound_pos(const key_type& key) const
+    {
+      size_type first = 0;
+      size_type count = m_sorted_size;
+      while (count > 0)
+      {
+        const size_type half = count >> 1;
+        if (key_compare()(m_array[first + half].first, key))
+        {
+          first += half + 1;
+          count -= half + 1;
+        }
+        else
+          count = half;
+      }
+      return first;
+    }
+
+    size_type upper_bound_pos(const key_type& key) const
+    {
+      size_type first = 0;
+      size_type count = m_sorted_size;
+      while (count > 0)
+      {
+        const size_type half = count >> 1;
+        if (key_compare()(key, m_array[first + half].first))
+          count = half;
+        else
+        {
+          first += half + 1;
+          count -= half + 1;
+        }
+      }
+      return first;
+    }
+
+    /// Pairs, sorted by key up to m_sorted_size, then appended by push_back()
+    array_t   m_array;
+    /// Number of leading pairs known to be sorted and merged
+    size_type m_sorted_size;
+  };
+}
+#endif  // _GLUCAT_FLAT_MAP_H
@@ -35,11 +35,19 @@
 #include "glucat/errors.h"
 #include "glucat/clifford_algebra.h"
 
-#if defined(_GLUCAT_USE_BOOST_POOL_ALLOC)
+#if defined(_GLUCAT_USE_ARENA_ALLOC)
+// Use the scoped arena allocator
+#include "glucat/arena.h"
+#elif defined(_GLUCAT_USE_BOOST_POOL_ALLOC)
 // Use the Boost pool allocator
 #include <boost/pool/poolfwd.hpp>
 #endif
 
+#if defined(_GLUCAT_USE_THREADS)
+// Use the thread pool for large geometric products
+#include "glucat/thread_pool.h"
+#endif
+
 #include <string>
 #include <utility>
 #include <map>
@@ -47,16 +55,31 @@
 
 // Use the appropriate type of map
 
-#if defined(_GLUCAT_USE_STD_UNORDERED_MAP)
+#if defined(_GLUCAT_USE_FLAT_MAP)
+# include "glucat/flat_map.h"
+#elif defined(_GLUCAT_USE_OPEN_HASH_MAP)
+# include "glucat/open_hash_map.h"
+#elif defined(_GLUCAT_USE_STD_UNORDERED_MAP)
 # include <unordered_map>
 #endif
 
-#if defined(_GLUCAT_USE_STD_UNORDERED_MAP)
+#if defined(_GLUCAT_USE_FLAT_MAP)
+# define _GLUCAT_MAP_IS_FLAT
+# define _GLUCAT_MAP_IS_ORDERED
+#elif defined(_GLUCAT_USE_OPEN_HASH_MAP)
+# define _GLUCAT_MAP_IS_OPEN_HASH
+# define _GLUCAT_MAP_IS_HASH
+#elif defined(_GLUCAT_USE_STD_UNORDERED_MAP)
 # define _GLUCAT_MAP_IS_HASH
 #else
 # define _GLUCAT_MAP_IS_ORDERED
 #endif
 
+// The arena allocator is used only with std::map<> and std::unordered_map<>
+#if defined(_GLUCAT_USE_ARENA_ALLOC) && !defined(_GLUCAT_MAP_IS_FLAT) && !defined(_GLUCAT_MAP_IS_OPEN_HASH)
+# define _GLUCAT_MAP_IS_ARENA
+#endif
+
 namespace glucat
 {
   // Forward declarations for friends
@@ -67,6 +90,15 @@ namespace glucat
   template< typename Scalar_T, const index_t LO, const index_t HI >
   class matrix_multi; // forward
 
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  class vector_multi; // forward
+
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  class batch_product; // forward
+
+  template< typename Scalar_T, const index_t P, const index_t Q, const index_t LO, const index_t HI >
+  class fixed_multi; // forward
+
   /// Geometric product
   template< typename Scalar_T, const index_t LO, const index_t HI >
   const framed_multi<Scalar_T,LO,HI>
@@ -134,12 +166,23 @@ namespace glucat
   template< typename Scalar_T = double,  const index_t LO = DEFAULT_LO, const index_t HI = DEFAULT_HI >
   class framed_multi :
   public clifford_algebra< Scalar_T, index_set<LO,HI>, framed_multi<Scalar_T,LO,HI> >,
-#if defined(_GLUCAT_USE_STD_UNORDERED_MAP)
-  private std::unordered_map< index_set<LO,HI>, Scalar_T, index_set_hash<LO,HI> >
+#if defined(_GLUCAT_MAP_IS_FLAT)
+  private flat_map< index_set<LO,HI>, Scalar_T, std::less< const index_set<LO,HI> > >
+#elif defined(_GLUCAT_MAP_IS_OPEN_HASH)
+  private open_hash_map< index_set<LO,HI>, Scalar_T, index_set_hash<LO,HI> >
+#elif defined(_GLUCAT_MAP_IS_HASH)
+  private std::unordered_map< index_set<LO,HI>, Scalar_T, index_set_hash<LO,HI>
+#if defined(_GLUCAT_USE_ARENA_ALLOC)
+                            , std::equal_to< index_set<LO,HI> >
+                            , arena_allocator< std::pair<const index_set<LO,HI>, Scalar_T> >
+#endif
+                            >
 #else
   private std::map< index_set<LO,HI>, Scalar_T,
                     std::less< const index_set<LO,HI> >
-#if defined(_GLUCAT_USE_BOOST_POOL_ALLOC)
+#if defined(_GLUCAT_USE_ARENA_ALLOC)
+                  , arena_allocator< std::pair<const index_set<LO,HI>, Scalar_T> >
+#elif defined(_GLUCAT_USE_BOOST_POOL_ALLOC)
                   , boost::fast_pool_allocator< std::pair<const index_set<LO,HI>, Scalar_T> >
 #endif
                   >
@@ -158,20 +201,41 @@ namespace glucat
     friend class matrix_multi;
     template< typename Other_Scalar_T, const index_t Other_LO, const index_t Other_HI >
     friend class framed_multi;
+    template< typename Other_Scalar_T, const index_t Other_LO, const index_t Other_HI >
+    friend class vector_multi;
+    template< typename Other_Scalar_T, const index_t Other_LO, const index_t Other_HI >
+    friend class batch_product;
+    template< typename Other_Scalar_T, const index_t P, const index_t Q, const index_t Other_LO, const index_t Other_HI >
+    friend class fixed_multi;
 
   private:
     class                                              var_term; // forward
     typedef class var_term                             var_term_t;
     typedef typename matrix_multi_t::matrix_t          matrix_t;
+#if defined(_GLUCAT_MAP_IS_FLAT)
+    typedef flat_map< index_set_t, Scalar_T, std::less<const index_set_t> >
+                                                       sorted_map_t;
+#else
     typedef std::map< index_set_t, Scalar_T,
                       std::less<const index_set_t>
-#if defined(_GLUCAT_USE_BOOST_POOL_ALLOC)
+#if defined(_GLUCAT_USE_ARENA_ALLOC)
+                    , arena_allocator<term_t>
+#elif defined(_GLUCAT_USE_BOOST_POOL_ALLOC)
                     , boost::fast_pool_allocator<term_t>
 #endif
                     >
                                                        sorted_map_t;
-#if defined(_GLUCAT_USE_STD_UNORDERED_MAP)
-    typedef std::unordered_map< index_set_t, Scalar_T, index_set_hash<LO,HI> >
+#endif
+#if defined(_GLUCAT_MAP_IS_OPEN_HASH)
+    typedef open_hash_map< index_set_t, Scalar_T, index_set_hash<LO,HI> >
+                                                       map_t;
+#elif defined(_GLUCAT_MAP_IS_HASH)
+    typedef std::unordered_map< index_set_t, Scalar_T, index_set_hash<LO,HI>
+#if defined(_GLUCAT_USE_ARENA_ALLOC)
+                              , std::equal_to<index_set_t>
+                              , arena_allocator<term_t>
+#endif
+                              >
                                                        map_t;
 #else
     typedef sorted_map_t                               map_t;
@@ -194,6 +258,7 @@ namespace glucat
     typedef typename map_t::size_type                  size_type;
     typedef typename map_t::iterator                   iterator;
     typedef typename map_t::const_iterator             const_iterator;
+    typedef typename map_t::value_type                 map_term_t;
 
   public:
     /// Class name used in messages
@@ -226,6 +291,9 @@ namespace glucat
     framed_multi(const Scalar_T& scr, const index_set_t frm = index_set_t());
     /// Construct a multivector from an int (within a frame, if given)
     framed_multi(const int scr, const index_set_t frm = index_set_t());
+    /// Construct a multivector from the value of a lazy expression
+    template< typename Expr_T >
+    framed_multi(const lazy_expr<Expr_T, multivector_t>& expr);
     /// Construct a multivector, within a given frame, from a given vector
     framed_multi(const vector_t& vec,
                  const index_set_t frm, const bool prechecked = false);
@@ -244,6 +312,9 @@ namespace glucat
     /// Construct a multivector from a matrix_multi_t
     template< typename Other_Scalar_T >
     framed_multi(const matrix_multi<Other_Scalar_T,LO,HI>& val);
+    /// Construct a multivector from a vector_multi_t
+    template< typename Other_Scalar_T >
+    framed_multi(const vector_multi<Other_Scalar_T,LO,HI>& val);
     /// Use generalized FFT to construct a matrix_multi_t
     template< typename Other_Scalar_T >
     const matrix_multi<Other_Scalar_T,LO,HI> fast_matrix_multi(const index_set_t frm) const;
@@ -289,6 +360,29 @@ namespace glucat
     multivector_t&      operator+= (const term_t& term);
 
   private:
+    /// Add a term, if non-zero, deferring the work of merging where possible
+    void                push_term(const term_t& term);
+    /// Merge all terms added by push_term
+    void                merge_terms();
+    /// Replace the value of this multivector by the value of val, leaving val unspecified
+    multivector_t&      take_value(multivector_t& val);
+    /// Add the products of the terms of lhs from lhs_begin to lhs_end with the terms of rhs to an array
+    static void         mult_add_array(const const_iterator& lhs_begin, const const_iterator& lhs_end,
+                                       const multivector_t& rhs, const index_set_t our_frame,
+                                       const set_value_t* signs, std::vector<Scalar_T>& result_array);
+#if defined(_GLUCAT_USE_THREADS)
+    /// Should a geometric product of nbr_pairs pairs of terms use the thread pool?
+    static bool         use_thread_pool(const double nbr_pairs);
+    /// Sum the partial results of a parallel product into partial[0], using the thread pool
+    static void         sum_partial(std::vector<multivector_t>& partial);
+    /// Geometric product which stores the result directly, using the thread pool
+    static const multivector_t
+                        threaded_direct_mult(const multivector_t& lhs, const multivector_t& rhs);
+    /// Geometric product which stores the result in an array, using the thread pool
+    static const multivector_t
+                        threaded_array_mult(const multivector_t& lhs, const multivector_t& rhs,
+                                            const index_set_t our_frame, const set_value_t* signs);
+#endif
     /// Subalgebra isomorphism: fold each term within the given frame
     multivector_t       fold(const index_set_t frm) const;
     /// Subalgebra isomorphism: unfold each term within the given frame
@@ -332,6 +426,116 @@ namespace glucat
         return *this;
       }
     };
+
+    /// Index of the terms of a multivector, grouped by grade
+    // Built by the products kernels, so that they can skip grades which cannot contribute.
+    // Within each grade, the terms are in the order of the map.
+    class grade_index
+    {
+    public:
+      typedef const map_term_t*                        term_ptr_t;
+
+      /// Build the index of the terms of val, using a counting sort by grade
+      grade_index(const multivector_t& val)
+      : m_terms(val.size()),
+        m_begin(HI-LO + 2, 0),
+        m_max_grade(0)
+      {
+        const const_iterator val_begin = val.begin();
+        const const_iterator val_end   = val.end();
+        for (const_iterator
+            val_it = val_begin;
+            val_it != val_end;
+            ++val_it)
+        {
+          const index_t grade = val_it->first.count();
+          ++this->m_begin[grade + 1];
+          if (grade > this->m_max_grade)
+            this->m_max_grade = grade;
+        }
+        for (index_t
+            grade = 0;
+            grade != this->m_max_grade + 1;
+            ++grade)
+          this->m_begin[grade + 1] += this->m_begin[grade];
+        std::vector<size_type> next(this->m_begin.begin(), this->m_begin.begin() + this->m_max_grade + 1);
+        for (const_iterator
+            val_it = val_begin;
+            val_it != val_end;
+            ++val_it)
+          this->m_terms[next[val_it->first.count()]++] = &*val_it;
+      }
+      /// Maximum grade of the terms
+      index_t    max_grade() const
+      { return this->m_max_grade; }
+      /// First term of the given grade, which must not exceed max_grade()
+      const term_ptr_t* begin(const index_t grade) const
+      { return this->m_terms.empty() ? 0 : &this->m_terms[0] + this->m_begin[grade]; }
+      /// End of the terms of the given grade, which must not exceed max_grade()
+      const term_ptr_t* end(const index_t grade) const
+      { return this->m_terms.empty() ? 0 : &this->m_terms[0] + this->m_begin[grade + 1]; }
+    private:
+      /// Pointers to the terms, sorted by grade
+      std::vector<term_ptr_t> m_terms;
+      /// Position in m_terms of the first term of each grade
+      std::vector<size_type>  m_begin;
+      /// Maximum grade of the terms
+      index_t                 m_max_grade;
+    };
+
+    /// Frame for dense arrays of coordinates, indexed by the value of the fold of each index set
+    // Used by the products kernels for large operands, so that each subset of a
+    // result index set is found by indexing an array rather than by a map lookup.
+    // Shifting a folded index set so that its negative indices end at -1 preserves
+    // both order and signature, so the sign of a product needs only the two values.
+    // The kernels enumerate submasks, so they take O(3^n) operations in a frame of count n.
+    // Ranked zeta and Moebius transforms would give O(n^2 2^n) for an unsigned subset
+    // convolution, but the sign of a product is a bilinear form in the two index sets,
+    // and does not factor through the ranks that these transforms keep.
+    class dense_frame
+    {
+    public:
+      typedef std::vector<Scalar_T>                    array_t;
+
+      /// Frame for dense arrays within frm
+      dense_frame(const index_set_t frm)
+      : m_frame(frm),
+        m_shift(-LO - frm.count_neg())
+      { }
+      /// Number of coordinates in each array
+      set_value_t dim() const
+      { return set_value_t(1) << this->m_frame.count(); }
+      /// Value of the fold of ist, which must lie within the frame
+      set_value_t value_of(const index_set_t ist) const
+      { return ist.value_of_fold(this->m_frame); }
+      /// Index set with the given value of its fold
+      const index_set_t index_set(const set_value_t stv) const
+      { return index_set_t(stv, this->m_frame, true); }
+      /// Dense array of the coordinates of val, which must lie within the frame
+      const array_t coords(const multivector_t& val) const
+      {
+        array_t result(this->dim(), Scalar_T(0));
+        const const_iterator val_end = val.end();
+        for (const_iterator
+            val_it = val.begin();
+            val_it != val_end;
+            ++val_it)
+          result[this->value_of(val_it->first)] = val_it->second;
+        return result;
+      }
+      /// Sign of the geometric product of the basis elements with the given values of folds
+      int sign_of_mult(const set_value_t lhs_stv, const set_value_t rhs_stv) const
+      { return this->shifted(lhs_stv).sign_of_mult(this->shifted(rhs_stv)); }
+    private:
+      /// Folded index set, shifted so that its negative indices end at -1
+      const index_set_t shifted(const set_value_t stv) const
+      { return index_set_t(std::bitset<HI-LO>(stv) << this->m_shift); }
+
+      /// Frame of the arrays
+      const index_set_t m_frame;
+      /// Shift from the value of a fold to the bits of the shifted index set
+      const index_t     m_shift;
+    };
   };
 
   // Non-members
@@ -351,6 +555,19 @@ namespace glucat
    (const std::pair<const index_set<LO,HI>, Scalar_T>& lhs,
     const std::pair<const index_set<LO,HI>, Scalar_T>& rhs);
 
+  /// Coordinate of product of terms stored with mutable index sets
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  Scalar_T
+  crd_of_mult(const std::pair<index_set<LO,HI>, Scalar_T>& lhs,
+              const std::pair<index_set<LO,HI>, Scalar_T>& rhs);
+
+  /// Product of terms stored with mutable index sets
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  const std::pair<const index_set<LO,HI>, Scalar_T>
+  operator*
+   (const std::pair<index_set<LO,HI>, Scalar_T>& lhs,
+    const std::pair<index_set<LO,HI>, Scalar_T>& rhs);
+
   /// Square root of multivector with specified complexifier
   template< typename Scalar_T, const index_t LO, const index_t HI >
   const framed_multi<Scalar_T,LO,HI>
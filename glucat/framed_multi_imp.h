@@ -157,6 +157,13 @@ namespace glucat
       this->insert(term_t(index_set_t(), Scalar_T(scr)));
   }
 
+  /// Construct a multivector from the value of a lazy expression
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  template< typename Expr_T >
+  framed_multi<Scalar_T,LO,HI>::
+  framed_multi(const lazy_expr<Expr_T, multivector_t>& expr)
+  { lazy_eval(*this, expr); }
+
   /// Construct a multivector, within a given frame, from a given vector
   template< typename Scalar_T, const index_t LO, const index_t HI >
   framed_multi<Scalar_T,LO,HI>::
@@ -256,11 +263,34 @@ namespace glucat
     {
       const index_set_t ist = index_set_t(stv, frm, true);
       const Scalar_T crd =
-        traits_t::to_scalar_t(matrix::inner<Other_Scalar_T>(val.basis_element(ist), val.m_matrix));
+        traits_t::to_scalar_t(matrix::signed_perm_inner<Other_Scalar_T>(val.basis_element(ist), val.m_matrix));
       const Scalar_T abs_crd = traits_t::abs(crd);
       if ((abs_crd * abs_crd) > tol)
-        this->insert(term_t(ist, crd));
+        this->push_term(term_t(ist, crd));
     }
+    this->merge_terms();
+  }
+
+  /// Construct a multivector from a vector_multi_t
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  template< typename Other_Scalar_T >
+  framed_multi<Scalar_T,LO,HI>::
+  framed_multi(const vector_multi<Other_Scalar_T,LO,HI>& val)
+  : map_t(_GLUCAT_HASH_N(val.nbr_terms()))
+  {
+    typedef numeric_traits<Scalar_T> traits_t;
+    const index_set_t frm = val.frame();
+    const set_value_t algebra_dim = val.m_array.size();
+    for (set_value_t
+        stv = 0;
+        stv != algebra_dim;
+        stv++)
+    {
+      const Other_Scalar_T& crd = val.m_array[stv];
+      if (crd != Other_Scalar_T(0))
+        this->push_term(term_t(index_set_t(stv, frm, true), traits_t::to_scalar_t(crd)));
+    }
+    this->merge_terms();
   }
 
   /// Test for equality of multivectors
@@ -339,11 +369,16 @@ namespace glucat
   framed_multi<Scalar_T,LO,HI>::
   operator+= (const multivector_t& rhs)
   { // simply add terms
+#if defined(_GLUCAT_MAP_IS_FLAT)
+    if (&rhs == this)
+      return *this += multivector_t(rhs);
+#endif
     for (const_iterator
         rhs_it = rhs.begin();
         rhs_it != rhs.end();
         ++rhs_it)
-      *this += *rhs_it;
+      this->push_term(*rhs_it);
+    this->merge_terms();
     return *this;
   }
 
@@ -354,14 +389,65 @@ namespace glucat
   framed_multi<Scalar_T,LO,HI>::
   operator-= (const multivector_t& rhs)
   {
+#if defined(_GLUCAT_MAP_IS_FLAT)
+    if (&rhs == this)
+      return *this -= multivector_t(rhs);
+#endif
     for (const_iterator
         rhs_it = rhs.begin();
         rhs_it != rhs.end();
         ++rhs_it)
-      *this += term_t(rhs_it->first, -(rhs_it->second));
+      this->push_term(term_t(rhs_it->first, -(rhs_it->second)));
+    this->merge_terms();
     return *this;
   }
 
+  /// Geometric sum of multivector and product of multivector and scalar
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  framed_multi<Scalar_T,LO,HI>&
+  framed_multi<Scalar_T,LO,HI>::
+  add_scaled(const multivector_t& rhs, const Scalar_T& crd)
+  {
+    typedef numeric_traits<Scalar_T> traits_t;
+
+    if (&rhs == this || crd == Scalar_T(0) || traits_t::isNaN_or_isInf(crd))
+      return *this += rhs * crd;
+    for (const_iterator
+        rhs_it = rhs.begin();
+        rhs_it != rhs.end();
+        ++rhs_it)
+      this->push_term(term_t(rhs_it->first, rhs_it->second * crd));
+    this->merge_terms();
+    return *this;
+  }
+
+  /// Assign the value of a lazy expression
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  template< typename Expr_T >
+  inline
+  framed_multi<Scalar_T,LO,HI>&
+  framed_multi<Scalar_T,LO,HI>::
+  operator= (const lazy_expr<Expr_T, multivector_t>& rhs)
+  { return lazy_assign(*this, rhs); }
+
+  /// Geometric sum of multivector and lazy expression
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  template< typename Expr_T >
+  inline
+  framed_multi<Scalar_T,LO,HI>&
+  framed_multi<Scalar_T,LO,HI>::
+  operator+= (const lazy_expr<Expr_T, multivector_t>& rhs)
+  { return lazy_add(*this, rhs, Scalar_T(1)); }
+
+  /// Geometric difference of multivector and lazy expression
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  template< typename Expr_T >
+  inline
+  framed_multi<Scalar_T,LO,HI>&
+  framed_multi<Scalar_T,LO,HI>::
+  operator-= (const lazy_expr<Expr_T, multivector_t>& rhs)
+  { return lazy_add(*this, rhs, Scalar_T(-1)); }
+
   /// Unary -
   template< typename Scalar_T, const index_t LO, const index_t HI >
   inline
@@ -394,6 +480,140 @@ namespace glucat
     return *this;
   }
 
+  /// Table of signs of products of basis elements within folded frames
+  // The table for a frame of count indices, count_neg of them negative, has one bit
+  // for each pair of basis elements within the frame. The bit for the basis elements
+  // whose folds have values j and k is bit number (j << count) + k, and is set if
+  // their product is negative. Their product has the fold with value j ^ k.
+  // Tables are only ever added, so a pointer to a table remains valid.
+  template< const index_t LO, const index_t HI >
+  class mult_table :
+  private std::map< std::pair<index_t, index_t>, std::vector<set_value_t> >
+  {
+  public:
+    typedef index_set<LO,HI>                                           index_set_t;
+    typedef std::map< std::pair<index_t, index_t>, std::vector<set_value_t> > map_t;
+
+    /// Single instance of multiplication table
+    static mult_table& table() { static mult_table t; return t; }
+    /// Bits of the table of signs for a frame with the given counts of indices
+    const set_value_t* signs(const index_t count, const index_t count_neg)
+    {
+#if defined(_GLUCAT_USE_THREADS)
+      std::lock_guard<std::mutex> lock(this->m_mutex);
+#endif
+      const typename map_t::key_type key(count, count_neg);
+      const typename map_t::const_iterator table_it = this->find(key);
+      if (table_it != this->end())
+        return &(table_it->second)[0];
+      std::vector<set_value_t>& bits = (*this)[key];
+      const set_value_t dim = set_value_t(1) << count;
+      bits.resize(std::max(set_value_t(1), dim * dim / BITS_PER_SET_VALUE), 0);
+      // Shift each fold so that its negative indices end at -1
+      const index_t shift = -LO - count_neg;
+      for (set_value_t
+          lhs_stv = 0;
+          lhs_stv != dim;
+          ++lhs_stv)
+      {
+        const index_set_t lhs_ist = index_set_t(std::bitset<HI-LO>(lhs_stv) << shift);
+        for (set_value_t
+            rhs_stv = 0;
+            rhs_stv != dim;
+            ++rhs_stv)
+          if (lhs_ist.sign_of_mult(index_set_t(std::bitset<HI-LO>(rhs_stv) << shift)) < 0)
+          {
+            const set_value_t bit = (lhs_stv << count) + rhs_stv;
+            bits[bit / BITS_PER_SET_VALUE] |= set_value_t(1) << (bit % BITS_PER_SET_VALUE);
+          }
+      }
+      return &bits[0];
+    }
+  private:
+    // Enforce singleton
+    // Reference: A. Alexandrescu, "Modern C++ Design", Chapter 6
+    mult_table() {}
+    ~mult_table() {}
+    mult_table(const mult_table&);
+    mult_table& operator= (const mult_table&);
+
+#if defined(_GLUCAT_USE_THREADS)
+    /// Guards the map of tables
+    std::mutex m_mutex;
+#endif
+
+    /// Friend declaration to avoid compiler warning:
+    /// "... only defines a private destructor and has no friends"
+    /// Ref: Carlos O'Ryan, ACE http://doc.ece.uci.edu
+    friend class friend_for_private_destructor;
+  };
+
+  /// Add the products of the terms of lhs from lhs_begin to lhs_end with the terms of rhs to an array
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  void
+  framed_multi<Scalar_T,LO,HI>::
+  mult_add_array(const const_iterator& lhs_begin, const const_iterator& lhs_end,
+                 const multivector_t& rhs, const index_set_t our_frame,
+                 const set_value_t* signs, std::vector<Scalar_T>& result_array)
+  {
+    const const_iterator rhs_begin = rhs.begin();
+    const const_iterator rhs_end   = rhs.end();
+    if (signs == 0)
+    {
+      for (const_iterator
+          lhs_it = lhs_begin;
+          lhs_it != lhs_end;
+          ++lhs_it)
+      {
+        const map_term_t& lhs_term = *lhs_it;
+        for (const_iterator
+            rhs_it = rhs_begin;
+            rhs_it != rhs_end;
+            ++rhs_it)
+        {
+          const term_t& term = lhs_term * *rhs_it;
+          result_array[term.first.value_of_fold(our_frame)] += term.second;
+        }
+      }
+      return;
+    }
+    // Fold each term of rhs once, then look up the sign of each product in the table
+    const size_t rhs_size = rhs.size();
+    std::vector<set_value_t> rhs_stv(rhs_size);
+    std::vector<Scalar_T>    rhs_crd(rhs_size);
+    typename std::vector<set_value_t>::iterator stv_it = rhs_stv.begin();
+    typename std::vector<Scalar_T>::iterator    crd_it = rhs_crd.begin();
+    for (const_iterator
+        rhs_it = rhs_begin;
+        rhs_it != rhs_end;
+        ++rhs_it, ++stv_it, ++crd_it)
+    {
+      *stv_it = rhs_it->first.value_of_fold(our_frame);
+      *crd_it = rhs_it->second;
+    }
+    const index_t frm_count = our_frame.count();
+    for (const_iterator
+        lhs_it = lhs_begin;
+        lhs_it != lhs_end;
+        ++lhs_it)
+    {
+      const set_value_t lhs_stv = lhs_it->first.value_of_fold(our_frame);
+      const Scalar_T    lhs_crd = lhs_it->second;
+      const set_value_t row = lhs_stv << frm_count;
+      for (size_t
+          k = 0;
+          k != rhs_size;
+          ++k)
+      {
+        const set_value_t bit = row + rhs_stv[k];
+        const Scalar_T    crd = ((signs[bit / BITS_PER_SET_VALUE] >> (bit % BITS_PER_SET_VALUE)) & 1)
+                              ? -lhs_crd
+                              :  lhs_crd;
+        result_array[lhs_stv ^ rhs_stv[k]] += crd * rhs_crd[k];
+      }
+    }
+  }
+
   /// Geometric product
   template< typename Scalar_T, const index_t LO, const index_t HI >
   const framed_multi<Scalar_T,LO,HI>
@@ -402,8 +622,8 @@ namespace glucat
     typedef framed_multi<Scalar_T,LO,HI> multivector_t;
     typedef numeric_traits<Scalar_T> traits_t;
     typedef typename multivector_t::index_set_t index_set_t;
-    typedef typename multivector_t::term_t term_t;
     typedef typename multivector_t::map_t map_t;
+    typedef typename multivector_t::map_term_t map_term_t;
     typedef typename map_t::const_iterator const_iterator;
 
     if (lhs.isnan() || rhs.isnan())
@@ -421,6 +641,10 @@ namespace glucat
                            ;
     if (direct_mult)
     { // If we have a sparse multiply, store the result directly
+#if defined(_GLUCAT_USE_THREADS)
+      if (multivector_t::use_thread_pool(lhs_size * rhs_size))
+        return multivector_t::threaded_direct_mult(lhs, rhs);
+#endif
       multivector_t result =
         multivector_t(_GLUCAT_HASH_SIZE_T(size_t(std::min(lhs_size * rhs_size, double(algebra_dim)))));
       const const_iterator lhs_begin = lhs.begin();
@@ -433,49 +657,40 @@ namespace glucat
           lhs_it != lhs_end;
           ++lhs_it)
       {
-        const term_t& lhs_term = *lhs_it;
+        const map_term_t& lhs_term = *lhs_it;
         for (const_iterator
             rhs_it = rhs_begin;
             rhs_it != rhs_end;
             ++rhs_it)
-          result += lhs_term * *rhs_it;
+          result.push_term(lhs_term * *rhs_it);
       }
+      result.merge_terms();
       return result;
     }
 #if !defined(_GLUCAT_MAP_IS_HASH)
     else if (frm_count < Tune_P::mult_matrix_threshold)
     { // Fastest dense algorithm in low dimensions stores result in array
+      typedef typename multivector_t::term_t term_t;
+      // For small enough frames, use the cached table of signs of products of basis elements
+      typedef mult_table<LO,HI> mult_table_t;
+      const set_value_t* signs = (frm_count <= index_t(Tune_P::mult_table_max_count))
+                               ? mult_table_t::table().signs(frm_count, our_frame.count_neg())
+                               : 0;
+#if defined(_GLUCAT_USE_THREADS)
+      if (multivector_t::use_thread_pool(lhs_size * rhs_size))
+        return multivector_t::threaded_array_mult(lhs, rhs, our_frame, signs);
+#endif
       typedef std::vector<Scalar_T> array_t;
       array_t result_array(algebra_dim, Scalar_T(0));
-
-      const const_iterator lhs_begin = lhs.begin();
-      const const_iterator lhs_end   = lhs.end();
-      const const_iterator rhs_begin = rhs.begin();
-      const const_iterator rhs_end   = rhs.end();
-
-      for (const_iterator
-          lhs_it = lhs_begin;
-          lhs_it != lhs_end;
-          ++lhs_it)
-      {
-        const term_t& lhs_term = *lhs_it;
-        for (const_iterator
-            rhs_it = rhs_begin;
-            rhs_it != rhs_end;
-            ++rhs_it)
-        {
-          const term_t& term = lhs_term * *rhs_it;
-          const set_value_t stv = term.first.value_of_fold(our_frame);
-          result_array[stv] += term.second;
-        }
-      }
+      multivector_t::mult_add_array(lhs.begin(), lhs.end(), rhs, our_frame, signs, result_array);
       multivector_t result;
       for (set_value_t
           stv = 0;
           stv != algebra_dim;
           ++stv)
         if (result_array[stv] != Scalar_T(0))
-          result.insert(term_t(index_set_t(stv, our_frame, true), result_array[stv]));
+          result.push_term(term_t(index_set_t(stv, our_frame, true), result_array[stv]));
+      result.merge_terms();
       return result;
     }
 #endif
@@ -493,7 +708,10 @@ namespace glucat
   framed_multi<Scalar_T,LO,HI> &
   framed_multi<Scalar_T,LO,HI>::
   operator*= (const multivector_t& rhs)
-  { return *this = *this * rhs; }
+  {
+    multivector_t result = *this * rhs;
+    return this->take_value(result);
+  }
 
   /// Outer product
   template< typename Scalar_T, const index_t LO, const index_t HI >
@@ -509,6 +727,7 @@ namespace glucat
     typedef typename multivector_t::index_set_t index_set_t;
     typedef typename multivector_t::term_t term_t;
     typedef typename multivector_t::map_t map_t;
+    typedef typename multivector_t::map_term_t map_term_t;
     typedef typename map_t::const_iterator const_iterator;
 
     multivector_t result;
@@ -522,12 +741,16 @@ namespace glucat
     const double rhs_size = rhs.size();
 
     if (lhs_size * rhs_size > double(Tune_P::products_size_threshold))
-    {
-      const index_set_t lhs_frame = lhs.frame();
-      const index_set_t rhs_frame = rhs.frame();
+    { // Enumerate the subsets of each result index set, using dense coordinate arrays
+      typedef typename multivector_t::dense_frame dense_frame_t;
+      typedef typename dense_frame_t::array_t array_t;
 
-      const index_set_t our_frame = lhs_frame | rhs_frame;
-      const set_value_t algebra_dim = 1 << our_frame.count();
+      const index_set_t lhs_frame = lhs.frame();
+      const dense_frame_t dense(lhs_frame | rhs.frame());
+      const array_t lhs_coords = dense.coords(lhs);
+      const array_t rhs_coords = dense.coords(rhs);
+      const set_value_t lhs_mask = dense.value_of(lhs_frame);
+      const set_value_t algebra_dim = dense.dim();
       multivector_t result =
         multivector_t(_GLUCAT_HASH_SIZE_T(size_t(std::min(lhs_size * rhs_size, double(algebra_dim)))));
       for (set_value_t
@@ -535,31 +758,59 @@ namespace glucat
           result_stv != algebra_dim;
           ++result_stv)
       {
-        const index_set_t result_ist = index_set_t(result_stv, our_frame, true);
-        const index_set_t lhs_result_frame = lhs_frame & result_ist;
-        const set_value_t lhs_result_dim = 1 << lhs_result_frame.count();
+        const set_value_t lhs_result_mask = lhs_mask & result_stv;
         Scalar_T result_crd = Scalar_T(0);
-        for (set_value_t
-            lhs_stv = 0;
-            lhs_stv != lhs_result_dim;
-            ++lhs_stv)
+        // Visit each subset of lhs_result_mask in increasing order, ending when the value wraps to 0
+        set_value_t lhs_stv = 0;
+        do
         {
-          const index_set_t lhs_ist = index_set_t(lhs_stv, lhs_result_frame, true);
-          const index_set_t rhs_ist = result_ist ^ lhs_ist;
-          if ((rhs_ist | rhs_frame) == rhs_frame)
+          const Scalar_T& lhs_crd = lhs_coords[lhs_stv];
+          if (lhs_crd != Scalar_T(0))
           {
-            const const_iterator lhs_it = lhs.find(lhs_ist);
-            if (lhs_it != lhs_end)
-            {
-              const const_iterator rhs_it = rhs.find(rhs_ist);
-              if (rhs_it != rhs_end)
-                result_crd += crd_of_mult(*lhs_it, *rhs_it);
-            }
+            const set_value_t rhs_stv = result_stv ^ lhs_stv;
+            const Scalar_T& rhs_crd = rhs_coords[rhs_stv];
+            if (rhs_crd != Scalar_T(0))
+              result_crd += dense.sign_of_mult(lhs_stv, rhs_stv) * lhs_crd * rhs_crd;
           }
-        }
+          lhs_stv = (lhs_stv - lhs_result_mask) & lhs_result_mask;
+        } while (lhs_stv != 0);
         if (result_crd != Scalar_T(0))
-          result.insert(term_t(result_ist, result_crd));
+          result.push_term(term_t(dense.index_set(result_stv), result_crd));
       }
+      result.merge_terms();
+      return result;
+    }
+    else if (lhs_size * rhs_size > double(Tune_P::grade_index_size_threshold))
+    { // Disjoint index sets within our frame have grades which sum to at most its count
+      typedef typename multivector_t::grade_index grade_index_t;
+      typedef typename grade_index_t::term_ptr_t term_ptr_t;
+
+      const index_t frm_count = (lhs.frame() | rhs.frame()).count();
+      const grade_index_t lhs_index(lhs);
+      multivector_t result;
+      for (const_iterator
+          rhs_it = rhs_begin;
+          rhs_it != rhs_end;
+          ++rhs_it)
+      {
+        const map_term_t& rhs_term = *rhs_it;
+        const index_set_t rhs_ist = rhs_term.first;
+        const index_t max_grade = std::min(frm_count - rhs_ist.count(), lhs_index.max_grade());
+        for (index_t
+            grade = 0;
+            grade <= max_grade;
+            ++grade)
+          for (const term_ptr_t*
+              lhs_ptr = lhs_index.begin(grade);
+              lhs_ptr != lhs_index.end(grade);
+              ++lhs_ptr)
+          {
+            const map_term_t& lhs_term = **lhs_ptr;
+            if ((lhs_term.first & rhs_ist) == empty_set)
+              result.push_term(lhs_term * rhs_term);
+          }
+      }
+      result.merge_terms();
       return result;
     }
     else
@@ -570,19 +821,20 @@ namespace glucat
           rhs_it != rhs_end;
           ++rhs_it)
       {
-        const term_t& rhs_term = *rhs_it;
+        const map_term_t& rhs_term = *rhs_it;
         const index_set_t rhs_ist = rhs_term.first;
         for (const_iterator
             lhs_it = lhs_begin;
             lhs_it != lhs_end;
             ++lhs_it)
         {
-          const term_t& lhs_term = *lhs_it;
+          const map_term_t& lhs_term = *lhs_it;
           const index_set_t lhs_ist = lhs_term.first;
           if ((lhs_ist & rhs_ist) == empty_set)
-            result += lhs_term * rhs_term;
+            result.push_term(lhs_term * rhs_term);
         }
       }
+      result.merge_terms();
       return result;
     }
   }
@@ -593,7 +845,10 @@ namespace glucat
   framed_multi<Scalar_T,LO,HI> &
   framed_multi<Scalar_T,LO,HI>::
   operator^= (const multivector_t& rhs)
-  { return *this = *this ^ rhs; }
+  {
+    multivector_t result = *this ^ rhs;
+    return this->take_value(result);
+  }
 
   /// Inner product
   template< typename Scalar_T, const index_t LO, const index_t HI >
@@ -609,6 +864,7 @@ namespace glucat
     typedef typename multivector_t::index_set_t index_set_t;
     typedef typename multivector_t::term_t term_t;
     typedef typename multivector_t::map_t map_t;
+    typedef typename multivector_t::map_term_t map_term_t;
     typedef typename map_t::const_iterator const_iterator;
 
     const const_iterator lhs_end   = lhs.end();
@@ -617,12 +873,14 @@ namespace glucat
     const double rhs_size = rhs.size();
 
     if (lhs_size * rhs_size > double(Tune_P::products_size_threshold))
-    {
-      const index_set_t lhs_frame = lhs.frame();
-      const index_set_t rhs_frame = rhs.frame();
-
-      const index_set_t our_frame = lhs_frame | rhs_frame;
-      const set_value_t algebra_dim = 1 << our_frame.count();
+    { // Enumerate the supersets of each result index set, using dense coordinate arrays
+      typedef typename multivector_t::dense_frame dense_frame_t;
+      typedef typename dense_frame_t::array_t array_t;
+
+      const dense_frame_t dense(lhs.frame() | rhs.frame());
+      const array_t lhs_coords = dense.coords(lhs);
+      const array_t rhs_coords = dense.coords(rhs);
+      const set_value_t algebra_dim = dense.dim();
       multivector_t result =
         multivector_t(_GLUCAT_HASH_SIZE_T(size_t(std::min(lhs_size * rhs_size, double(algebra_dim)))));
       for (set_value_t
@@ -630,44 +888,95 @@ namespace glucat
           result_stv != algebra_dim;
           ++result_stv)
       {
-        const index_set_t result_ist = index_set_t(result_stv, our_frame, true);
-        const index_set_t comp_frame = our_frame & ~result_ist;
-        const set_value_t comp_dim = 1 << comp_frame.count();
+        const set_value_t comp_mask = (algebra_dim - 1) & ~result_stv;
         Scalar_T result_crd = Scalar_T(0);
+        // Visit each non-empty subset of comp_mask in increasing order
         for (set_value_t
-            comp_stv = 1;
-            comp_stv != comp_dim;
-            ++comp_stv)
+            comp_stv = (set_value_t(0) - comp_mask) & comp_mask;
+            comp_stv != 0;
+            comp_stv = (comp_stv - comp_mask) & comp_mask)
         {
-          const index_set_t comp_ist = index_set_t(comp_stv, comp_frame, true);
-          const index_set_t our_ist = result_ist ^ comp_ist;
-          if ((our_ist | lhs_frame) == lhs_frame)
+          const set_value_t our_stv = result_stv ^ comp_stv;
+          const Scalar_T& lhs_our_crd = lhs_coords[our_stv];
+          if (lhs_our_crd != Scalar_T(0))
           {
-            const const_iterator lhs_it = lhs.find(our_ist);
-            if (lhs_it != lhs_end)
-            {
-              const const_iterator rhs_it = rhs.find(comp_ist);
-              if (rhs_it != rhs_end)
-                result_crd += crd_of_mult(*lhs_it, *rhs_it);
-            }
+            const Scalar_T& rhs_crd = rhs_coords[comp_stv];
+            if (rhs_crd != Scalar_T(0))
+              result_crd += dense.sign_of_mult(our_stv, comp_stv) * lhs_our_crd * rhs_crd;
           }
           if (result_stv != 0)
           {
-            if ((our_ist | rhs_frame) == rhs_frame)
+            const Scalar_T& rhs_crd = rhs_coords[our_stv];
+            if (rhs_crd != Scalar_T(0))
             {
-              const const_iterator rhs_it = rhs.find(our_ist);
-              if (rhs_it != rhs_end)
-              {
-                const const_iterator lhs_it = lhs.find(comp_ist);
-                if (lhs_it != lhs_end)
-                  result_crd += crd_of_mult(*lhs_it, *rhs_it);
-              }
+              const Scalar_T& lhs_crd = lhs_coords[comp_stv];
+              if (lhs_crd != Scalar_T(0))
+                result_crd += dense.sign_of_mult(comp_stv, our_stv) * lhs_crd * rhs_crd;
             }
           }
         }
         if (result_crd != Scalar_T(0))
-          result.insert(term_t(result_ist, result_crd));
+          result.push_term(term_t(dense.index_set(result_stv), result_crd));
+      }
+      result.merge_terms();
+      return result;
+    }
+    else if (lhs_size * rhs_size > double(Tune_P::grade_index_size_threshold))
+    { // Compare grades to decide which index set must contain the other
+      typedef typename multivector_t::grade_index grade_index_t;
+      typedef typename grade_index_t::term_ptr_t term_ptr_t;
+
+      const const_iterator lhs_begin = lhs.begin();
+      const grade_index_t rhs_index(rhs);
+      const index_t rhs_max_grade = rhs_index.max_grade();
+
+      multivector_t result;
+      for (const_iterator
+          lhs_it = lhs_begin;
+          lhs_it != lhs_end;
+          ++lhs_it)
+      {
+        const map_term_t& lhs_term = *lhs_it;
+        const index_set_t lhs_ist = lhs_term.first;
+        const index_t lhs_grade = lhs_ist.count();
+        if (lhs_grade != 0)
+          for (index_t
+              grade = 1;
+              grade <= rhs_max_grade;
+              ++grade)
+          {
+            const term_ptr_t* rhs_begin = rhs_index.begin(grade);
+            const term_ptr_t* rhs_end   = rhs_index.end(grade);
+            if (grade < lhs_grade)
+            {
+              for (const term_ptr_t*
+                  rhs_ptr = rhs_begin;
+                  rhs_ptr != rhs_end;
+                  ++rhs_ptr)
+                if (((*rhs_ptr)->first | lhs_ist) == lhs_ist)
+                  result.push_term(lhs_term * **rhs_ptr);
+            }
+            else if (grade == lhs_grade)
+            {
+              for (const term_ptr_t*
+                  rhs_ptr = rhs_begin;
+                  rhs_ptr != rhs_end;
+                  ++rhs_ptr)
+                if ((*rhs_ptr)->first == lhs_ist)
+                  result.push_term(lhs_term * **rhs_ptr);
+            }
+            else
+            {
+              for (const term_ptr_t*
+                  rhs_ptr = rhs_begin;
+                  rhs_ptr != rhs_end;
+                  ++rhs_ptr)
+                if ((lhs_ist | (*rhs_ptr)->first) == (*rhs_ptr)->first)
+                  result.push_term(lhs_term * **rhs_ptr);
+            }
+          }
       }
+      result.merge_terms();
       return result;
     }
     else
@@ -683,7 +992,7 @@ namespace glucat
           lhs_it != lhs_end;
           ++lhs_it)
       {
-        const term_t& lhs_term = *lhs_it;
+        const map_term_t& lhs_term = *lhs_it;
         const index_set_t lhs_ist = lhs_term.first;
         if (lhs_ist != empty_set)
           for (const_iterator
@@ -691,16 +1000,17 @@ namespace glucat
               rhs_it != rhs_end;
               ++rhs_it)
           {
-            const term_t& rhs_term = *rhs_it;
+            const map_term_t& rhs_term = *rhs_it;
             const index_set_t rhs_ist = rhs_term.first;
             if (rhs_ist != empty_set)
             {
               const index_set_t our_ist = lhs_ist | rhs_ist;
               if ((lhs_ist == our_ist) || (rhs_ist == our_ist))
-                result += lhs_term * rhs_term;
+                result.push_term(lhs_term * rhs_term);
             }
           }
       }
+      result.merge_terms();
       return result;
     }
   }
@@ -711,7 +1021,10 @@ namespace glucat
   framed_multi<Scalar_T,LO,HI> &
   framed_multi<Scalar_T,LO,HI>::
   operator&= (const multivector_t& rhs)
-  { return *this = *this & rhs; }
+  {
+    multivector_t result = *this & rhs;
+    return this->take_value(result);
+  }
 
   /// Left contraction
   template< typename Scalar_T, const index_t LO, const index_t HI >
@@ -728,8 +1041,8 @@ namespace glucat
 
     typedef framed_multi<Scalar_T,LO,HI> multivector_t;
     typedef typename multivector_t::index_set_t index_set_t;
-    typedef typename multivector_t::term_t term_t;
     typedef typename multivector_t::map_t map_t;
+    typedef typename multivector_t::map_term_t map_term_t;
     typedef typename map_t::const_iterator const_iterator;
 
 #if defined(_GLUCAT_MAP_IS_ORDERED)
@@ -750,7 +1063,7 @@ namespace glucat
         rhs_it != rhs_rlower_bound;
         ++rhs_it)
     {
-      const term_t& rhs_term = *rhs_it;
+      const map_term_t& rhs_term = *rhs_it;
       const index_set_t rhs_ist = rhs_term.first;
       const const_iterator lhs_upper_bound = lhs.upper_bound(rhs_ist);
       for (const_iterator
@@ -758,26 +1071,32 @@ namespace glucat
           lhs_it != lhs_upper_bound;
           ++lhs_it)
       {
-        const term_t& lhs_term = *lhs_it;
+        const map_term_t& lhs_term = *lhs_it;
         const index_set_t lhs_ist = lhs_term.first;
         if ((lhs_ist | rhs_ist) == rhs_ist)
-          result += lhs_term * rhs_term;
+          result.push_term(lhs_term * rhs_term);
       }
     }
+    result.merge_terms();
     return result;
 #else
+    typedef typename multivector_t::term_t term_t;
     const const_iterator lhs_end   = lhs.end();
     const const_iterator rhs_end   = rhs.end();
     const double lhs_size = lhs.size();
     const double rhs_size = rhs.size();
 
     if (lhs_size * rhs_size > double(Tune_P::products_size_threshold))
-    {
-      const index_set_t lhs_frame = lhs.frame();
-      const index_set_t rhs_frame = rhs.frame();
+    { // Enumerate the subsets of the complement of each result index set, using dense coordinate arrays
+      typedef typename multivector_t::dense_frame dense_frame_t;
+      typedef typename dense_frame_t::array_t array_t;
 
-      const index_set_t our_frame = lhs_frame | rhs_frame;
-      const set_value_t algebra_dim = 1 << our_frame.count();
+      const index_set_t lhs_frame = lhs.frame();
+      const dense_frame_t dense(lhs_frame | rhs.frame());
+      const array_t lhs_coords = dense.coords(lhs);
+      const array_t rhs_coords = dense.coords(rhs);
+      const set_value_t lhs_mask = dense.value_of(lhs_frame);
+      const set_value_t algebra_dim = dense.dim();
       multivector_t result =
         multivector_t(_GLUCAT_HASH_SIZE_T(size_t(std::min(lhs_size * rhs_size, double(algebra_dim)))));
       for (set_value_t
@@ -785,31 +1104,60 @@ namespace glucat
           result_stv != algebra_dim;
           ++result_stv)
       {
-        const index_set_t result_ist = index_set_t(result_stv, our_frame, true);
-        const index_set_t comp_frame = lhs_frame & ~result_ist;
-        const set_value_t comp_dim = 1 << comp_frame.count();
+        const set_value_t comp_mask = lhs_mask & ~result_stv;
         Scalar_T result_crd = Scalar_T(0);
-        for (set_value_t
-            comp_stv = 0;
-            comp_stv != comp_dim;
-            ++comp_stv)
+        // Visit each subset of comp_mask in increasing order, ending when the value wraps to 0
+        set_value_t comp_stv = 0;
+        do
         {
-          const index_set_t comp_ist = index_set_t(comp_stv, comp_frame, true);
-          const index_set_t rhs_ist = result_ist ^ comp_ist;
-          if ((rhs_ist | rhs_frame) == rhs_frame)
+          const set_value_t rhs_stv = result_stv ^ comp_stv;
+          const Scalar_T& rhs_crd = rhs_coords[rhs_stv];
+          if (rhs_crd != Scalar_T(0))
           {
-            const const_iterator rhs_it = rhs.find(rhs_ist);
-            if (rhs_it != rhs_end)
-            {
-              const const_iterator lhs_it = lhs.find(comp_ist);
-              if (lhs_it != lhs_end)
-                result_crd += crd_of_mult(*lhs_it, *rhs_it);
-            }
+            const Scalar_T& lhs_crd = lhs_coords[comp_stv];
+            if (lhs_crd != Scalar_T(0))
+              result_crd += dense.sign_of_mult(comp_stv, rhs_stv) * lhs_crd * rhs_crd;
           }
-        }
+          comp_stv = (comp_stv - comp_mask) & comp_mask;
+        } while (comp_stv != 0);
         if (result_crd != Scalar_T(0))
-          result.insert(term_t(result_ist, result_crd));
+          result.push_term(term_t(dense.index_set(result_stv), result_crd));
       }
+      result.merge_terms();
+      return result;
+    }
+    else if (lhs_size * rhs_size > double(Tune_P::grade_index_size_threshold))
+    { // An index set can be a subset of another only if its grade is no larger
+      typedef typename multivector_t::grade_index grade_index_t;
+      typedef typename grade_index_t::term_ptr_t term_ptr_t;
+
+      const const_iterator rhs_begin = rhs.begin();
+      const grade_index_t lhs_index(lhs);
+
+      multivector_t result;
+      for (const_iterator
+          rhs_it = rhs_begin;
+          rhs_it != rhs_end;
+          ++rhs_it)
+      {
+        const map_term_t& rhs_term = *rhs_it;
+        const index_set_t rhs_ist = rhs_term.first;
+        const index_t max_grade = std::min(rhs_ist.count(), lhs_index.max_grade());
+        for (index_t
+            grade = 0;
+            grade <= max_grade;
+            ++grade)
+          for (const term_ptr_t*
+              lhs_ptr = lhs_index.begin(grade);
+              lhs_ptr != lhs_index.end(grade);
+              ++lhs_ptr)
+          {
+            const map_term_t& lhs_term = **lhs_ptr;
+            if ((lhs_term.first | rhs_ist) == rhs_ist)
+              result.push_term(lhs_term * rhs_term);
+          }
+      }
+      result.merge_terms();
       return result;
     }
     else
@@ -823,19 +1171,20 @@ namespace glucat
           rhs_it != rhs_end;
           ++rhs_it)
       {
-        const term_t& rhs_term = *rhs_it;
+        const map_term_t& rhs_term = *rhs_it;
         const index_set_t rhs_ist = rhs_term.first;
         for (const_iterator
             lhs_it = lhs_begin;
             lhs_it != lhs_end;
             ++lhs_it)
         {
-          const term_t& lhs_term = *lhs_it;
+          const map_term_t& lhs_term = *lhs_it;
           const index_set_t lhs_ist = lhs_term.first;
           if ((lhs_ist | rhs_ist) == rhs_ist)
-            result += lhs_term * rhs_term;
+            result.push_term(lhs_term * rhs_term);
         }
       }
+      result.merge_terms();
       return result;
     }
 #endif
@@ -847,7 +1196,10 @@ namespace glucat
   framed_multi<Scalar_T,LO,HI> &
   framed_multi<Scalar_T,LO,HI>::
   operator%= (const multivector_t& rhs)
-  { return *this = *this % rhs; }
+  {
+    multivector_t result = *this % rhs;
+    return this->take_value(result);
+  }
 
   /// Hestenes scalar product
   template< typename Scalar_T, const index_t LO, const index_t HI >
@@ -870,6 +1222,30 @@ namespace glucat
       ? &rhs
       : &lhs;
 
+#if defined(_GLUCAT_MAP_IS_ORDERED)
+    // If the operands are of comparable size, merging the two sorted sequences of terms
+    // takes fewer comparisons than a search of the larger operand for each smaller term.
+    const double small_size = smallp->size();
+    const double large_size = largep->size();
+    if (large_size < small_size * double(largep->frame().count()))
+    {
+      const const_iterator small_end = smallp->end();
+      const const_iterator large_end = largep->end();
+      const_iterator large_it = largep->begin();
+      for (const_iterator
+           small_it = smallp->begin();
+           small_it != small_end && large_it != large_end;
+           ++small_it)
+      {
+        const index_set_t small_ist = small_it->first;
+        while (large_it != large_end && large_it->first < small_ist)
+          ++large_it;
+        if (large_it != large_end && large_it->first == small_ist)
+          result += small_ist.sign_of_square() * small_it->second * large_it->second;
+      }
+      return result;
+    }
+#endif
     for (const_iterator
          small_it = smallp->begin();
          small_it != smallp->end();
@@ -931,7 +1307,10 @@ namespace glucat
   framed_multi<Scalar_T,LO,HI> &
   framed_multi<Scalar_T,LO,HI>::
   operator/= (const multivector_t& rhs)
-  { return *this = *this / rhs; }
+  {
+    multivector_t result = *this / rhs;
+    return this->take_value(result);
+  }
 
   /// Transformation via twisted adjoint action
   template< typename Scalar_T, const index_t LO, const index_t HI >
@@ -951,7 +1330,10 @@ namespace glucat
   framed_multi<Scalar_T,LO,HI>&
   framed_multi<Scalar_T,LO,HI>::
   operator|= (const multivector_t& rhs)
-  { return *this = *this | rhs; }
+  {
+    multivector_t result = *this | rhs;
+    return this->take_value(result);
+  }
 
   /// Clifford multiplicative inverse
   template< typename Scalar_T, const index_t LO, const index_t HI >
@@ -1296,8 +1678,9 @@ namespace glucat
       if (generator.uniform() < fill)
       {
         const Scalar_T& result_crd = generator.normal() / mean_abs;
-        result.insert(term_t(index_set_t(stv, frm, true), result_crd));
+        result.push_term(term_t(index_set_t(stv, frm, true), result_crd));
       }
+    result.merge_terms();
     return result;
   }
 
@@ -1372,13 +1755,14 @@ namespace glucat
     else
     {
       typedef framed_multi<Scalar_T,LO,HI>  multivector_t;
+      typedef typename multivector_t::term_t term_t;
       typedef typename multivector_t::map_t map_t;
       typedef typename multivector_t::sorted_map_t sorted_map_t;
       typedef typename sorted_map_t::const_iterator sorted_iterator;
       sorted_map_t sorted_val;
       sorted_range< map_t, sorted_map_t > sorted_val_range(sorted_val, val);
       sorted_iterator sorted_it = sorted_val_range.sorted_begin;
-      os << *sorted_it;
+      os << term_t(*sorted_it);
       for (++sorted_it;
           sorted_it != sorted_val_range.sorted_end;
           ++sorted_it)
@@ -1386,7 +1770,7 @@ namespace glucat
         const Scalar_T& scr = sorted_it->second;
         if (scr >= 0.0)
           os << '+';
-        os << *sorted_it;
+        os << term_t(*sorted_it);
       }
     }
     return os;
@@ -1553,6 +1937,10 @@ namespace glucat
   operator+= (const term_t& term)
   { // Do not insert terms with 0 coordinate
     if (term.second != Scalar_T(0))
+#if defined(_GLUCAT_MAP_IS_OPEN_HASH)
+      // Find, then insert, add or erase, using a single probe
+      this->add(term);
+#else
     {
       const iterator& this_it = this->find(term.first);
       if (this_it == this->end())
@@ -1563,9 +1951,267 @@ namespace glucat
       else
         this_it->second += term.second;
     }
+#endif
     return *this;
   }
 
+  /// Add a term, if non-zero, deferring the work of merging where possible
+  // With a flat map, the term is appended, and merge_terms() must be called
+  // before the multivector is next used.
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  inline
+  void
+  framed_multi<Scalar_T,LO,HI>::
+  push_term(const term_t& term)
+  {
+#if defined(_GLUCAT_MAP_IS_FLAT)
+    if (term.second != Scalar_T(0))
+      this->push_back(term);
+#else
+    *this += term;
+#endif
+  }
+
+  /// Merge all terms added by push_term
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  inline
+  void
+  framed_multi<Scalar_T,LO,HI>::
+  merge_terms()
+  {
+#if defined(_GLUCAT_MAP_IS_FLAT)
+    this->sort_and_merge();
+#endif
+  }
+
+  /// Replace the value of this multivector by the value of val, leaving val unspecified
+  // The terms are exchanged rather than copied.
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  inline
+  framed_multi<Scalar_T,LO,HI> &
+  framed_multi<Scalar_T,LO,HI>::
+  take_value(multivector_t& val)
+  {
+#if defined(_GLUCAT_MAP_IS_ARENA)
+    // Maps can exchange terms only if they allocate from the same arena scope
+    if (this->get_allocator() != val.get_allocator())
+      return *this = val;
+#endif
+    this->map_t::swap(val);
+    return *this;
+  }
+
+#if defined(_GLUCAT_USE_THREADS)
+  /// Should a geometric product of nbr_pairs pairs of terms use the thread pool?
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  inline
+  bool
+  framed_multi<Scalar_T,LO,HI>::
+  use_thread_pool(const double nbr_pairs)
+  {
+#if defined(_GLUCAT_USE_ARENA_ALLOC)
+    // The arena of a scope must only be used by the thread which owns the scope
+    if (arena_scope::current() != 0)
+      return false;
+#endif
+    return nbr_pairs > double(Tune_P::mult_threads_size_threshold)
+        && thread_pool::pool().size() > 1;
+  }
+
+  /// Sum the partial results of a parallel product into partial[0], using the thread pool
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  void
+  framed_multi<Scalar_T,LO,HI>::
+  sum_partial(std::vector<multivector_t>& partial)
+  {
+    // Each task adds one partial result to another, halving the number left at each level
+    class sum_task
+    {
+    public:
+      sum_task(std::vector<multivector_t>& partial, const size_t step)
+      : m_partial(partial), m_step(step)
+      { }
+      void operator() (const size_t k)
+      {
+        const size_t pos = 2 * this->m_step * k;
+        this->m_partial[pos] += this->m_partial[pos + this->m_step];
+      }
+    private:
+      std::vector<multivector_t>& m_partial;
+      const size_t                m_step;
+    };
+
+    const size_t nbr_partial = partial.size();
+    for (size_t
+        step = 1;
+        step < nbr_partial;
+        step *= 2)
+    {
+      sum_task task(partial, step);
+      thread_pool::pool().run((nbr_partial - step + 2 * step - 1) / (2 * step), task);
+    }
+  }
+
+  /// Geometric product which stores the result directly, using the thread pool
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  const framed_multi<Scalar_T,LO,HI>
+  framed_multi<Scalar_T,LO,HI>::
+  threaded_direct_mult(const multivector_t& lhs, const multivector_t& rhs)
+  {
+    // Each task multiplies one part of the terms of lhs by rhs, giving one partial result
+    class mult_task
+    {
+    public:
+      mult_task(const std::vector<const_iterator>& part_begin, const multivector_t& rhs,
+                std::vector<multivector_t>& partial)
+      : m_part_begin(part_begin), m_rhs(rhs), m_partial(partial)
+      { }
+      void operator() (const size_t k)
+      {
+        multivector_t& result = this->m_partial[k];
+        const const_iterator lhs_end   = this->m_part_begin[k + 1];
+        const const_iterator rhs_begin = this->m_rhs.begin();
+        const const_iterator rhs_end   = this->m_rhs.end();
+        for (const_iterator
+            lhs_it = this->m_part_begin[k];
+            lhs_it != lhs_end;
+            ++lhs_it)
+        {
+          const map_term_t& lhs_term = *lhs_it;
+          for (const_iterator
+              rhs_it = rhs_begin;
+              rhs_it != rhs_end;
+              ++rhs_it)
+            result.push_term(lhs_term * *rhs_it);
+        }
+        result.merge_terms();
+      }
+    private:
+      const std::vector<const_iterator>& m_part_begin;
+      const multivector_t&               m_rhs;
+      std::vector<multivector_t>&        m_partial;
+    };
+
+    // Split the terms of lhs into one part for each thread
+    const size_t lhs_size = lhs.size();
+    const size_t nbr_parts = std::min(thread_pool::pool().size(), lhs_size);
+    std::vector<const_iterator> part_begin(nbr_parts + 1);
+    const_iterator lhs_it = lhs.begin();
+    for (size_t
+        k = 0;
+        k != nbr_parts;
+        ++k)
+    {
+      part_begin[k] = lhs_it;
+      std::advance(lhs_it, (k + 1) * lhs_size / nbr_parts - k * lhs_size / nbr_parts);
+    }
+    part_begin[nbr_parts] = lhs.end();
+
+    std::vector<multivector_t> partial(nbr_parts);
+    mult_task task(part_begin, rhs, partial);
+    thread_pool::pool().run(nbr_parts, task);
+    sum_partial(partial);
+    multivector_t result;
+    return result.take_value(partial[0]);
+  }
+
+  /// Geometric product which stores the result in an array, using the thread pool
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  const framed_multi<Scalar_T,LO,HI>
+  framed_multi<Scalar_T,LO,HI>::
+  threaded_array_mult(const multivector_t& lhs, const multivector_t& rhs,
+                      const index_set_t our_frame, const set_value_t* signs)
+  {
+    typedef std::vector<Scalar_T> array_t;
+
+    // Each task multiplies one part of the terms of lhs by rhs, into one partial array
+    class mult_task
+    {
+    public:
+      mult_task(const std::vector<const_iterator>& part_begin, const multivector_t& rhs,
+                const index_set_t our_frame, const set_value_t* signs,
+                std::vector<array_t>& partial)
+      : m_part_begin(part_begin), m_rhs(rhs), m_frame(our_frame), m_signs(signs),
+        m_partial(partial)
+      { }
+      void operator() (const size_t k)
+      {
+        mult_add_array(this->m_part_begin[k], this->m_part_begin[k + 1],
+                       this->m_rhs, this->m_frame, this->m_signs, this->m_partial[k]);
+      }
+    private:
+      const std::vector<const_iterator>& m_part_begin;
+      const multivector_t&               m_rhs;
+      const index_set_t                  m_frame;
+      const set_value_t*                 m_signs;
+      std::vector<array_t>&              m_partial;
+    };
+
+    // Each task sums one slice of all of the partial arrays into the first partial array
+    class sum_task
+    {
+    public:
+      sum_task(std::vector<array_t>& partial)
+      : m_partial(partial)
+      { }
+      void operator() (const size_t k)
+      {
+        const size_t nbr_partial = this->m_partial.size();
+        const size_t dim = this->m_partial[0].size();
+        const size_t slice_end = (k + 1) * dim / nbr_partial;
+        array_t& result_array = this->m_partial[0];
+        for (size_t
+            part = 1;
+            part != nbr_partial;
+            ++part)
+        {
+          const array_t& part_array = this->m_partial[part];
+          for (size_t
+              stv = k * dim / nbr_partial;
+              stv != slice_end;
+              ++stv)
+            result_array[stv] += part_array[stv];
+        }
+      }
+    private:
+      std::vector<array_t>& m_partial;
+    };
+
+    // Split the terms of lhs into one part for each thread
+    const size_t lhs_size = lhs.size();
+    const size_t nbr_parts = std::min(thread_pool::pool().size(), lhs_size);
+    std::vector<const_iterator> part_begin(nbr_parts + 1);
+    const_iterator lhs_it = lhs.begin();
+    for (size_t
+        k = 0;
+        k != nbr_parts;
+        ++k)
+    {
+      part_begin[k] = lhs_it;
+      std::advance(lhs_it, (k + 1) * lhs_size / nbr_parts - k * lhs_size / nbr_parts);
+    }
+    part_begin[nbr_parts] = lhs.end();
+
+    const set_value_t algebra_dim = 1 << our_frame.count();
+    std::vector<array_t> partial(nbr_parts, array_t(algebra_dim, Scalar_T(0)));
+    mult_task mult(part_begin, rhs, our_frame, signs, partial);
+    thread_pool::pool().run(nbr_parts, mult);
+    sum_task sum(partial);
+    thread_pool::pool().run(nbr_parts, sum);
+
+    const array_t& result_array = partial[0];
+    multivector_t result;
+    for (set_value_t
+        stv = 0;
+        stv != algebra_dim;
+        ++stv)
+      if (result_array[stv] != Scalar_T(0))
+        result.push_term(term_t(index_set_t(stv, our_frame, true), result_array[stv]));
+    result.merge_terms();
+    return result;
+  }
+#endif
+
   /// Check if a multivector contains any IEEE NaN values
   template< typename Scalar_T, const index_t LO, const index_t HI >
   bool
@@ -1918,6 +2564,26 @@ namespace glucat
     return term_t(lhs.first ^ rhs.first, crd_of_mult(lhs, rhs));
   }
 
+  /// Coordinate of product of terms stored with mutable index sets
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  inline
+  static
+  Scalar_T
+  crd_of_mult(const std::pair<index_set<LO,HI>, Scalar_T>& lhs,
+              const std::pair<index_set<LO,HI>, Scalar_T>& rhs)
+  { return lhs.first.sign_of_mult(rhs.first) * lhs.second * rhs.second; }
+
+  /// Product of terms stored with mutable index sets
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  inline
+  const std::pair<const index_set<LO,HI>, Scalar_T>
+  operator* (const std::pair<index_set<LO,HI>, Scalar_T>& lhs,
+             const std::pair<index_set<LO,HI>, Scalar_T>& rhs)
+  {
+    typedef std::pair<const index_set<LO,HI>, Scalar_T> term_t;
+    return term_t(lhs.first ^ rhs.first, crd_of_mult(lhs, rhs));
+  }
+
   /// Square root of multivector with specified complexifier
   template< typename Scalar_T, const index_t LO, const index_t HI >
   const framed_multi<Scalar_T,LO,HI>
@@ -1954,6 +2620,11 @@ namespace glucat
     if (val == s)
       return traits_t::exp(s);
 
+    // Bivectors and other elements with a scalar square need no matrix computation
+    framed_multi<Scalar_T,LO,HI> result;
+    if (closed_form_exp(val, result))
+      return result;
+
     const double size = val.size();
     const index_t frm_count = val.frame().count();
     const set_value_t algebra_dim = 1 << frm_count;
@@ -2010,6 +2681,11 @@ namespace glucat
       else
         return traits_t::log(realval);
     }
+    // Rotors and other elements with a scalar square need no matrix computation
+    framed_multi<Scalar_T,LO,HI> result;
+    if (closed_form_log(val, result))
+      return result;
+
     typedef typename framed_multi<Scalar_T,LO,HI>::matrix_multi_t matrix_multi_t;
     return log(matrix_multi_t(val), matrix_multi_t(i), prechecked);
   }
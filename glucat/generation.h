@@ -31,8 +31,10 @@
      See also Arvind Raja's original header comments in glucat.h
  ***************************************************************************/
 
+#include "glucat/cache.h"
+
+#include <cstddef>
 #include <utility>
-#include <map>
 #include <vector>
 
 namespace glucat { namespace gen
@@ -43,18 +45,30 @@ namespace glucat { namespace gen
   typedef std::pair<index_t, index_t> signature_t;
 
   /// Table of generators for specific signatures
+  // The table is a cache, bounded by a memory budget, which evicts the generators
+  // for its least recently used signatures. With _GLUCAT_USE_THREADS, it is locked
+  // during each call, so that it can be used by several threads.
   template< class Matrix_T >
-  class generator_table :
-  private std::map< signature_t, std::vector<Matrix_T> >
+  class generator_table
   {
   public:
-    /// Pointer to generators for a specific signature
-    const Matrix_T* operator() (const index_t p, const index_t q);
+    /// Generators for a specific signature: generator k, for -q <= k <= p, is result[q + k]
+    const std::vector<Matrix_T> operator() (const index_t p, const index_t q);
+    /// Counters of the use of the table
+    const cache_stats stats();
+    /// Change the memory budget of the table, evicting generators if needed
+    void set_max_bytes(const std::size_t max_bytes);
     /// Single instance of generator table
     static generator_table<Matrix_T>& generator();
   private:
     /// Construct a vector of generators for a specific signature
     const std::vector<Matrix_T>& gen_vector(const index_t p, const index_t q);
+    /// Save a vector of generators for a specific signature
+    void save_vector(const signature_t sig, const std::vector<Matrix_T>& result);
+#if defined(_GLUCAT_USE_BASIS_FILE)
+    /// Load and save the vector of generators for a specific signature from the basis file, if it holds them
+    bool load_vector(const signature_t sig);
+#endif
     /// Construct generators for p,q given generators for p-1,q-1
     void gen_from_pm1_qm1(const std::vector<Matrix_T>& old, const signature_t sig);
     /// Construct generators for p,q given generators for p-4,q+4
@@ -66,11 +80,18 @@ namespace glucat { namespace gen
 
     // Enforce singleton
     // Reference: A. Alexandrescu, "Modern C++ Design", Chapter 6
-    generator_table() {}
+    generator_table()
+    : m_cache(DEFAULT_Generator_Cache_Max_Bytes)
+    { }
     ~generator_table() {}
     generator_table(const generator_table&);
     generator_table& operator= (const generator_table&);
-    
+
+    /// Cache of vectors of generators
+    lru_cache< signature_t, std::vector<Matrix_T> > m_cache;
+    /// Guards the cache
+    cache_mutex_t                                   m_mutex;
+
     /// Friend declaration to avoid compiler warning:
     /// "... only defines a private destructor and has no friends"
     /// Ref: Carlos O'Ryan, ACE http://doc.ece.uci.edu
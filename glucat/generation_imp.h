@@ -50,30 +50,50 @@ namespace glucat { namespace gen
   generator()
   { static generator_table<Matrix_T> g; return g;}
 
-  /// Pointer to generators for a specific signature
+  /// Generators for a specific signature: generator k, for -q <= k <= p, is result[q + k]
   // Reference: [P] Table 15.27, p 133
   template< class Matrix_T >
-  inline
-  const Matrix_T*
+  const std::vector<Matrix_T>
   generator_table<Matrix_T>::
   operator() (const index_t p, const index_t q)
   {
     const index_t bott = pos_mod(p-q, 8);
-    switch(bott)
-    {
-    case 0:
-    case 2:
-      // Construct generators
-      return &(gen_vector(p, q)[q]);
-    default:
-      // Select generators from the vector for a larger frame
-      const index_t super_p = p + std::max(offset_to_super[bott],index_t(0));
-      const index_t super_q = q - std::min(offset_to_super[bott],index_t(0));
-      return &(gen_vector(super_p, super_q)[super_q]);
-    }
+    // Generators for bott == 0 or 2 are constructed, others are selected
+    // from the vector for a larger frame
+    const index_t super_p = p + std::max(offset_to_super[bott],index_t(0));
+    const index_t super_q = q - std::min(offset_to_super[bott],index_t(0));
+    cache_lock_t lock(this->m_mutex);
+    const std::vector<Matrix_T>* super_ptr = this->m_cache.find(signature_t(super_p, super_q));
+    if (super_ptr == 0)
+      super_ptr = &gen_vector(super_p, super_q);
+    const std::vector<Matrix_T> result(super_ptr->begin() + (super_q - q),
+                                       super_ptr->begin() + (super_q + p + 1));
+    this->m_cache.evict();
+    return result;
+  }
+
+  /// Counters of the use of the table
+  template< class Matrix_T >
+  const cache_stats
+  generator_table<Matrix_T>::
+  stats()
+  {
+    cache_lock_t lock(this->m_mutex);
+    return this->m_cache.stats();
+  }
+
+  /// Change the memory budget of the table, evicting generators if needed
+  template< class Matrix_T >
+  void
+  generator_table<Matrix_T>::
+  set_max_bytes(const std::size_t max_bytes)
+  {
+    cache_lock_t lock(this->m_mutex);
+    this->m_cache.set_max_bytes(max_bytes);
   }
 
   /// Construct a vector of generators for a specific signature
+  // The vectors used to construct this one stay in the cache until the next call to evict().
   template< class Matrix_T >
   const std::vector<Matrix_T>&
   generator_table<Matrix_T>::
@@ -83,7 +103,11 @@ namespace glucat { namespace gen
     const index_t bias = p - q;
     const index_t bott = pos_mod(bias, 8);
     const signature_t sig(p, q);
-    if (this->find(sig) == this->end())
+    if (this->m_cache.peek(sig) == 0
+#if defined(_GLUCAT_USE_BASIS_FILE)
+     && !this->load_vector(sig)
+#endif
+       )
       switch(bott)
       {
       case 0:
@@ -96,7 +120,7 @@ namespace glucat { namespace gen
         else if (card == 0)
         { // Base case. Save a generator vector containing one matrix, size 1.
           std::vector<Matrix_T> result(1, matrix::unit<Matrix_T>(1));
-          this->insert(make_pair(sig, result));
+          save_vector(sig, result);
         }
         else
           // Construct generators for p,q given generators for p-1,q-1
@@ -114,11 +138,58 @@ namespace glucat { namespace gen
           gen_from_qp1_pm1(gen_vector(q+1, p-1), sig);
         break;
       default:
+        save_vector(sig, std::vector<Matrix_T>());
         break;
       }
-    return (*this)[sig];
+    return *(this->m_cache.peek(sig));
+  }
+
+  /// Save a vector of generators for a specific signature
+  template< class Matrix_T >
+  void
+  generator_table<Matrix_T>::
+  save_vector(const signature_t sig, const std::vector<Matrix_T>& result)
+  {
+    // Estimate the size of each sparse matrix from its number of non-zeros and rows
+    typedef typename Matrix_T::value_type value_t;
+    typedef typename Matrix_T::size_type  matrix_index_t;
+    std::size_t bytes = sizeof(result) + result.size() * sizeof(Matrix_T);
+    for (typename std::vector<Matrix_T>::const_iterator
+        result_it = result.begin();
+        result_it != result.end();
+        ++result_it)
+      bytes += matrix::nnz(*result_it) * (sizeof(value_t) + sizeof(matrix_index_t))
+             + (result_it->size1() + 1) * sizeof(matrix_index_t);
+    this->m_cache.insert(sig, result, bytes);
+  }
+
+#if defined(_GLUCAT_USE_BASIS_FILE)
+  /// Load and save the vector of generators for a specific signature from the basis file, if it holds them
+  template< class Matrix_T >
+  bool
+  generator_table<Matrix_T>::
+  load_vector(const signature_t sig)
+  {
+    typedef typename Matrix_T::size_type matrix_index_t;
+    std::vector<matrix::signed_perm> gens;
+    if (!basis_file::file().generators(sig.first, sig.second, gens))
+      return false;
+    const matrix_index_t dim = gens[0].size();
+    std::vector<Matrix_T> result(gens.size());
+    for (std::size_t
+        k = 0;
+        k != gens.size();
+        ++k)
+    {
+      Matrix_T mtx(dim, dim, dim);
+      matrix::signed_perm_plus_assign(mtx, gens[k], 1);
+      result[k] = mtx;
+    }
+    save_vector(sig, result);
+    return true;
   }
 
+#endif
   /// Construct generators for p,q given generators for p-1,q-1
   // Reference: [P] Proposition 15.17, p 131
   template< class Matrix_T >
@@ -153,7 +224,7 @@ namespace glucat { namespace gen
     result[new_size-1] = matrix::mono_kron(pos, eye);
 
     // Save the resulting generator array.
-    this->insert(make_pair(sig, result));
+    save_vector(sig, result);
   }
 
   /// Construct generators for p,q given generators for p-4,q+4
@@ -184,7 +255,7 @@ namespace glucat { namespace gen
         ++k)
       result[k-4] = old[k];
     // Save the resulting generator array.
-    this->insert(make_pair(sig, result));
+    save_vector(sig, result);
   }
 
   /// Construct generators for p,q given generators for p+4,q-4
@@ -214,7 +285,7 @@ namespace glucat { namespace gen
         ++k)
       result[k] = old[k-4];
     // Save the resulting generator array.
-    this->insert(make_pair(sig, result));
+    save_vector(sig, result);
   }
 
   /// Construct generators for p,q given generators for q+1,p-1
@@ -236,7 +307,7 @@ namespace glucat { namespace gen
     result[old_size-1] = a;
 
     // Save the resulting generator array.
-    this->insert(make_pair(sig, result));
+    save_vector(sig, result);
   }
 
 } }
@@ -132,6 +132,14 @@ namespace glucat
   const unsigned int DEFAULT_Inv_Fast_Dim_Threshold  = 1 <<  3;
   const unsigned int DEFAULT_Products_Size_Threshold = 1 << 22;
   const precision_t  DEFAULT_Function_Precision      = precision_same;
+  const unsigned int DEFAULT_Dense_Mult_Matrix_Threshold = 14;
+  const unsigned int DEFAULT_Grade_Index_Size_Threshold  = 1 <<  8;
+  const unsigned int DEFAULT_Mult_Threads_Size_Threshold = 1 << 20;
+  const unsigned int DEFAULT_Mult_Table_Max_Count        =      10;
+  const unsigned int DEFAULT_Complex_Mult_Dim_Threshold  = 1 <<  5;
+  const precision_t  DEFAULT_Div_Factor_Precision       = precision_same;
+  const precision_t  DEFAULT_Div_Residual_Precision     = precision_same;
+  const unsigned int DEFAULT_Schur_Dim_Threshold        = 1 <<  3;
 
 
   /// Tuning policy
@@ -146,7 +154,15 @@ namespace glucat
     unsigned int Fast_Size_Threshold     = DEFAULT_Fast_Size_Threshold,
     unsigned int Inv_Fast_Dim_Threshold  = DEFAULT_Inv_Fast_Dim_Threshold,
     unsigned int Products_Size_Threshold = DEFAULT_Products_Size_Threshold,
-    precision_t  Function_Precision      = DEFAULT_Function_Precision
+    precision_t  Function_Precision      = DEFAULT_Function_Precision,
+    unsigned int Dense_Mult_Matrix_Threshold = DEFAULT_Dense_Mult_Matrix_Threshold,
+    unsigned int Grade_Index_Size_Threshold  = DEFAULT_Grade_Index_Size_Threshold,
+    unsigned int Mult_Threads_Size_Threshold = DEFAULT_Mult_Threads_Size_Threshold,
+    unsigned int Mult_Table_Max_Count        = DEFAULT_Mult_Table_Max_Count,
+    unsigned int Complex_Mult_Dim_Threshold  = DEFAULT_Complex_Mult_Dim_Threshold,
+    precision_t  Div_Factor_Precision       = DEFAULT_Div_Factor_Precision,
+    precision_t  Div_Residual_Precision     = DEFAULT_Div_Residual_Precision,
+    unsigned int Schur_Dim_Threshold        = DEFAULT_Schur_Dim_Threshold
   >
   struct tuning
   {
@@ -178,6 +194,29 @@ namespace glucat
   // Tuning for precision of exp, log and sqrt functions
     /// Precision used for exp, log and sqrt functions
     static const precision_t function_precision = Function_Precision;
+  // Tuning for multiplication of dense multivectors
+    /// Minimum index count needed to invoke matrix multiplication algorithm for vector_multi
+    enum { dense_mult_matrix_threshold = Dense_Mult_Matrix_Threshold };
+  // Tuning for products of sparse multivectors (other than geometric product)
+    /// Minimum number of pairs of terms needed to invoke grade-indexed products algorithms
+    enum { grade_index_size_threshold = Grade_Index_Size_Threshold };
+  // Tuning for multithreaded geometric product
+    /// Minimum number of pairs of terms needed to use the thread pool in the geometric product
+    enum { mult_threads_size_threshold = Mult_Threads_Size_Threshold };
+  // Tuning for cache of tables of signs of products of basis elements
+    /// Maximum index count of folded frames in multiplication table cache
+    enum { mult_table_max_count = Mult_Table_Max_Count };
+  // Tuning for multiplication of matrix_multi in signatures with complex representations
+    /// Minimum matrix dimension needed to multiply matrices as complex matrices of half the dimension
+    enum { complex_mult_dim_threshold = Complex_Mult_Dim_Threshold };
+  // Tuning for precision of division
+    /// Precision used for the LU factorization in division: demoted or same
+    static const precision_t div_factor_precision = Div_Factor_Precision;
+    /// Precision used for the residual of iterative refinement in division: same or promoted
+    static const precision_t div_residual_precision = Div_Residual_Precision;
+  // Tuning for sqrt and log of matrix_multi
+    /// Minimum matrix dimension needed to evaluate sqrt and log via the real Schur decomposition
+    enum { schur_dim_threshold = Schur_Dim_Threshold };
   };
 
   /// Modulo function which works reliably for lhs < 0
@@ -55,12 +55,32 @@
 
 #include "glucat/clifford_algebra.h"
 
+#include "glucat/lazy_expr.h"
+
 #include "glucat/framed_multi.h"
 
+#include "glucat/batch.h"
+
+#include "glucat/fixed_multi.h"
+
+#include "glucat/cache.h"
+
 #include "glucat/generation.h"
 
 #include "glucat/matrix.h"
 
+#include "glucat/matrix_backend.h"
+
+#include "glucat/matrix_schur.h"
+
+#if defined(_GLUCAT_USE_BASIS_FILE)
+#include "glucat/basis_file.h"
+#endif
+
 #include "glucat/matrix_multi.h"
 
+#include "glucat/divisor.h"
+
+#include "glucat/vector_multi.h"
+
 #endif  // _GLUCAT_GLUCAT_H
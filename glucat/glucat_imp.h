@@ -45,10 +45,26 @@
 
 #include "glucat/framed_multi_imp.h"
 
+#include "glucat/batch_imp.h"
+
+#include "glucat/fixed_multi_imp.h"
+
 #include "glucat/matrix_imp.h"
 
+#include "glucat/matrix_backend_imp.h"
+
+#include "glucat/matrix_schur_imp.h"
+
+#if defined(_GLUCAT_USE_BASIS_FILE)
+#include "glucat/basis_file_imp.h"
+#endif
+
 #include "glucat/generation_imp.h"
 
 #include "glucat/matrix_multi_imp.h"
 
+#include "glucat/divisor_imp.h"
+
+#include "glucat/vector_multi_imp.h"
+
 #endif  // _GLUCAT_GLUCAT_IMP_H
@@ -336,25 +336,50 @@ namespace glucat
     return *this;
   }
 
+  /// Number of bits set in x
+  inline
+  static
+  index_t
+  bit_count(unsigned long x)
+  {
+#if defined(_GLUCAT_POPCOUNTL)
+    return index_t(_GLUCAT_POPCOUNTL(x));
+#else
+    // Reference: [JA], 1.8
+    x -= (x >> 1) & (~0UL / 3UL);
+    x = (x & (~0UL / 5UL)) + ((x >> 2) & (~0UL / 5UL));
+    x = (x + (x >> 4)) & (~0UL / 17UL);
+    return index_t((x * (~0UL / 255UL)) >> (_GLUCAT_BITS_PER_ULONG - 8));
+#endif
+  }
+
+  /// Parity of the number of bits set in x
+  inline
+  static
+  unsigned long
+  bit_parity(unsigned long x)
+  {
+#if defined(_GLUCAT_PARITYL)
+    return (unsigned long)(_GLUCAT_PARITYL(x));
+#else
+    // Reference: [JA], 1.16
+#if (_GLUCAT_BITS_PER_ULONG >= 64)
+    x ^= x >> 32;
+#endif
+    x ^= x >> 16;
+    x ^= x >>  8;
+    x ^= x >>  4;
+    return (0x6996UL >> (x & 0xfUL)) & 1UL;
+#endif
+  }
+
   /// Cardinality: Number of indices included in set
   template<const index_t LO, const index_t HI>
   inline
   index_t
   index_set<LO,HI>::
   count() const
-  {
-    unsigned long val = bitset_t::to_ulong();
-    // Reference: [JA], 1.3
-    if (val == 0)
-      return 0;
-    else
-    {
-      index_t result = 1;
-      while (val &= val-1)
-        ++result;
-      return result;
-    }
-  }
+  { return bit_count(bitset_t::to_ulong()); }
 
   /// Number of negative indices included in set
   template<const index_t LO, const index_t HI>
@@ -883,41 +908,15 @@ namespace glucat
     // Reference: [JA]
     const unsigned long uthis = this->bitset_t::to_ulong();
     const unsigned long urhs  =   rhs.bitset_t::to_ulong();
-    const index_t nbits = HI - LO;
-    unsigned long negative = 0;
-    if (nbits > 8)
-    {
-      // Set h to be the inverse reversed Gray code of rhs.
-      // This sets each bit of h to be the cumulative ^ of
-      // the same and lower bits of rhs.
-      const unsigned long h = inverse_reversed_gray(urhs);
-      // Set k to be the inverse Gray code of *this & h.
-      // This sets the low bit of k to be parity(*this & h).
-      const unsigned long k = inverse_gray(uthis & h);
-      // Set q to be the inverse Gray code of the positive part of *this & rhs.
-      const unsigned long q = inverse_gray((uthis & urhs) >> -LO);
-      negative = k ^ q;
-    }
-    else
-    {
-      unsigned long h = 0;
-      index_t j;
-      for (j = 0;
-          j < -LO;
-          ++j)
-      {
-        h ^= urhs >> j;
-        negative ^= h & (uthis >> j);
-      }
-      for (j = -LO;
-          j < nbits;
-          ++j)
-      {
-        negative ^= h & (uthis >> j);
-        h ^= urhs >> j;
-      }
-    }
-    return 1 - int((negative & 1) << 1);
+    // Set h to be the inverse reversed Gray code of rhs.
+    // This sets each bit of h to be the cumulative ^ of
+    // the same and lower bits of rhs.
+    const unsigned long h = inverse_reversed_gray(urhs);
+    // The product is negative if parity(*this & h) differs from
+    // the parity of the positive part of *this & rhs.
+    const unsigned long negative =
+      bit_parity(uthis & h) ^ bit_parity((uthis & urhs) >> -LO);
+    return 1 - int(negative << 1);
   }
 
   /// Sign of geometric square of a Clifford basis element
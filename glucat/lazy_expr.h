@@ -0,0 +1,281 @@
+#ifndef _GLUCAT_LAZY_EXPR_H
+#define _GLUCAT_LAZY_EXPR_H
+/***************************************************************************
+    GluCat : Generic library of universal Clifford algebra templates
+    lazy_expr.h : Lazy linear combinations of multivectors
+                             -------------------
+    begin                : Sat 2026-10-17
+    copyright            : (C) 2001-2016 by Paul C. Leopardi
+ ***************************************************************************
+
+    This library is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published
+    by the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with this library.  If not, see <http://www.gnu.org/licenses/>.
+
+ ***************************************************************************
+ This library is based on a prototype written by Arvind Raja and was
+ licensed under the LGPL with permission of the author. See Arvind Raja,
+ "Object-oriented implementations of Clifford algebras in C++: a prototype",
+ in Ablamowicz, Lounesto and Parra (eds.)
+ "Clifford algebras with numeric and symbolic computations, Birkhauser, 1996."
+ ***************************************************************************
+ See also Arvind Raja's original header comments and references in glucat.h
+ ***************************************************************************/
+
+namespace glucat
+{
+  /// Lazy expression: a linear combination of multivectors, evaluated on assignment.
+  // Usage:
+  //   sum = lazy(a)*x + b - c;
+  // evaluates into sum by adding x*a, b and -c in turn, without any temporary multivectors.
+  // Each multivector in the expression is held by reference, so an expression must
+  // not outlive the statement in which it is created.
+  // Expr_T is the class derived from lazy_expr<>: each such class provides
+  // frame(), add_to() and refers_to().
+  template< typename Expr_T, typename Multivector_T >
+  class lazy_expr
+  {
+  public:
+    typedef Multivector_T                              multivector_t;
+    typedef typename multivector_t::scalar_t           scalar_t;
+    typedef typename multivector_t::index_set_t        index_set_t;
+
+    /// The expression as its derived class
+    const Expr_T&     derived() const
+    { return static_cast<const Expr_T&>(*this); }
+    /// Union of the frames of all multivectors in the expression
+    const index_set_t frame() const
+    { return derived().frame(); }
+    /// Add factor times the value of the expression to result
+    void              add_to(multivector_t& result, const scalar_t& factor) const
+    { derived().add_to(result, factor); }
+    /// Check if the expression refers to val
+    bool              refers_to(const multivector_t& val) const
+    { return derived().refers_to(val); }
+  };
+
+  /// Lazy expression: multivector times scalar coordinate
+  template< typename Multivector_T >
+  class lazy_term :
+  public lazy_expr< lazy_term<Multivector_T>, Multivector_T >
+  {
+  public:
+    typedef Multivector_T                              multivector_t;
+    typedef typename multivector_t::scalar_t           scalar_t;
+    typedef typename multivector_t::index_set_t        index_set_t;
+
+    lazy_term(const multivector_t& val, const scalar_t& crd)
+    : m_val(val), m_crd(crd)
+    { }
+    const multivector_t& value() const
+    { return m_val; }
+    const scalar_t&      coordinate() const
+    { return m_crd; }
+
+    const index_set_t frame() const
+    { return m_val.frame(); }
+    void              add_to(multivector_t& result, const scalar_t& factor) const
+    { result.add_scaled(m_val, m_crd * factor); }
+    bool              refers_to(const multivector_t& val) const
+    { return &m_val == &val; }
+  private:
+    const multivector_t& m_val;
+    const scalar_t       m_crd;
+  };
+
+  /// Lazy expression: sum of two lazy expressions
+  template< typename LHS_T, typename RHS_T, typename Multivector_T >
+  class lazy_sum :
+  public lazy_expr< lazy_sum<LHS_T, RHS_T, Multivector_T>, Multivector_T >
+  {
+  public:
+    typedef Multivector_T                              multivector_t;
+    typedef typename multivector_t::scalar_t           scalar_t;
+    typedef typename multivector_t::index_set_t        index_set_t;
+
+    lazy_sum(const LHS_T& lhs, const RHS_T& rhs)
+    : m_lhs(lhs), m_rhs(rhs)
+    { }
+
+    const index_set_t frame() const
+    { return m_lhs.frame() | m_rhs.frame(); }
+    void              add_to(multivector_t& result, const scalar_t& factor) const
+    {
+      m_lhs.add_to(result, factor);
+      m_rhs.add_to(result, factor);
+    }
+    bool              refers_to(const multivector_t& val) const
+    { return m_lhs.refers_to(val) || m_rhs.refers_to(val); }
+  private:
+    const LHS_T m_lhs;
+    const RHS_T m_rhs;
+  };
+
+  /// Lazy expression: lazy expression times scalar
+  template< typename Expr_T, typename Multivector_T >
+  class lazy_scaled :
+  public lazy_expr< lazy_scaled<Expr_T, Multivector_T>, Multivector_T >
+  {
+  public:
+    typedef Multivector_T                              multivector_t;
+    typedef typename multivector_t::scalar_t           scalar_t;
+    typedef typename multivector_t::index_set_t        index_set_t;
+
+    lazy_scaled(const Expr_T& expr, const scalar_t& crd)
+    : m_expr(expr), m_crd(crd)
+    { }
+
+    const index_set_t frame() const
+    { return m_expr.frame(); }
+    void              add_to(multivector_t& result, const scalar_t& factor) const
+    { m_expr.add_to(result, m_crd * factor); }
+    bool              refers_to(const multivector_t& val) const
+    { return m_expr.refers_to(val); }
+  private:
+    const Expr_T   m_expr;
+    const scalar_t m_crd;
+  };
+
+  /// Lazy expression referring to a multivector
+  template< typename Multivector_T >
+  inline
+  const lazy_term<Multivector_T>
+  lazy(const Multivector_T& val)
+  { return lazy_term<Multivector_T>(val, typename Multivector_T::scalar_t(1)); }
+
+  /// Lazy sum of lazy expressions
+  template< typename LHS_T, typename RHS_T, typename Multivector_T >
+  inline
+  const lazy_sum<LHS_T, RHS_T, Multivector_T>
+  operator+ (const lazy_expr<LHS_T, Multivector_T>& lhs, const lazy_expr<RHS_T, Multivector_T>& rhs)
+  { return lazy_sum<LHS_T, RHS_T, Multivector_T>(lhs.derived(), rhs.derived()); }
+
+  /// Lazy sum of lazy expression and multivector
+  template< typename LHS_T, typename Multivector_T >
+  inline
+  const lazy_sum<LHS_T, lazy_term<Multivector_T>, Multivector_T>
+  operator+ (const lazy_expr<LHS_T, Multivector_T>& lhs, const Multivector_T& rhs)
+  { return lhs + lazy(rhs); }
+
+  /// Lazy sum of multivector and lazy expression
+  template< typename RHS_T, typename Multivector_T >
+  inline
+  const lazy_sum<lazy_term<Multivector_T>, RHS_T, Multivector_T>
+  operator+ (const Multivector_T& lhs, const lazy_expr<RHS_T, Multivector_T>& rhs)
+  { return lazy(lhs) + rhs; }
+
+  /// Lazy difference of lazy expressions
+  template< typename LHS_T, typename RHS_T, typename Multivector_T >
+  inline
+  const lazy_sum<LHS_T, lazy_scaled<RHS_T, Multivector_T>, Multivector_T>
+  operator- (const lazy_expr<LHS_T, Multivector_T>& lhs, const lazy_expr<RHS_T, Multivector_T>& rhs)
+  { return lhs + -rhs; }
+
+  /// Lazy difference of lazy expression and multivector
+  template< typename LHS_T, typename Multivector_T >
+  inline
+  const lazy_sum<LHS_T, lazy_term<Multivector_T>, Multivector_T>
+  operator- (const lazy_expr<LHS_T, Multivector_T>& lhs, const Multivector_T& rhs)
+  { return lhs + -lazy(rhs); }
+
+  /// Lazy difference of multivector and lazy expression
+  template< typename RHS_T, typename Multivector_T >
+  inline
+  const lazy_sum<lazy_term<Multivector_T>, lazy_scaled<RHS_T, Multivector_T>, Multivector_T>
+  operator- (const Multivector_T& lhs, const lazy_expr<RHS_T, Multivector_T>& rhs)
+  { return lazy(lhs) + -rhs; }
+
+  /// Lazy product of lazy expression and scalar
+  template< typename Expr_T, typename Multivector_T >
+  inline
+  const lazy_scaled<Expr_T, Multivector_T>
+  operator* (const lazy_expr<Expr_T, Multivector_T>& lhs, const typename Multivector_T::scalar_t& scr)
+  { return lazy_scaled<Expr_T, Multivector_T>(lhs.derived(), scr); }
+
+  /// Lazy product of scalar and lazy expression
+  template< typename Expr_T, typename Multivector_T >
+  inline
+  const lazy_scaled<Expr_T, Multivector_T>
+  operator* (const typename Multivector_T::scalar_t& scr, const lazy_expr<Expr_T, Multivector_T>& rhs)
+  { return rhs * scr; }
+
+  /// Lazy product of lazy term and scalar: multiply the coordinate
+  template< typename Multivector_T >
+  inline
+  const lazy_term<Multivector_T>
+  operator* (const lazy_term<Multivector_T>& lhs, const typename Multivector_T::scalar_t& scr)
+  { return lazy_term<Multivector_T>(lhs.value(), lhs.coordinate() * scr); }
+
+  /// Lazy product of scalar and lazy term: multiply the coordinate
+  template< typename Multivector_T >
+  inline
+  const lazy_term<Multivector_T>
+  operator* (const typename Multivector_T::scalar_t& scr, const lazy_term<Multivector_T>& rhs)
+  { return rhs * scr; }
+
+  /// Lazy unary -
+  template< typename Expr_T, typename Multivector_T >
+  inline
+  const lazy_scaled<Expr_T, Multivector_T>
+  operator- (const lazy_expr<Expr_T, Multivector_T>& val)
+  { return val * typename Multivector_T::scalar_t(-1); }
+
+  /// Lazy unary - of lazy term: negate the coordinate
+  template< typename Multivector_T >
+  inline
+  const lazy_term<Multivector_T>
+  operator- (const lazy_term<Multivector_T>& val)
+  { return val * typename Multivector_T::scalar_t(-1); }
+
+  /// Evaluate a lazy expression into result, which the expression must not refer to
+  template< typename Expr_T, typename Multivector_T >
+  inline
+  Multivector_T&
+  lazy_eval(Multivector_T& result, const lazy_expr<Expr_T, Multivector_T>& expr)
+  {
+    typedef typename Multivector_T::scalar_t scalar_t;
+    result = Multivector_T(scalar_t(0), expr.frame());
+    expr.add_to(result, scalar_t(1));
+    return result;
+  }
+
+  /// Assign the value of a lazy expression to result
+  template< typename Expr_T, typename Multivector_T >
+  inline
+  Multivector_T&
+  lazy_assign(Multivector_T& result, const lazy_expr<Expr_T, Multivector_T>& expr)
+  {
+    if (expr.refers_to(result))
+    { // Ensure that there is no aliasing
+      Multivector_T value;
+      return result = lazy_eval(value, expr);
+    }
+    return lazy_eval(result, expr);
+  }
+
+  /// Add factor times the value of a lazy expression to result
+  template< typename Expr_T, typename Multivector_T >
+  inline
+  Multivector_T&
+  lazy_add(Multivector_T& result, const lazy_expr<Expr_T, Multivector_T>& expr,
+           const typename Multivector_T::scalar_t& factor)
+  {
+    if (expr.refers_to(result))
+    { // Ensure that there is no aliasing
+      Multivector_T value;
+      return result.add_scaled(lazy_eval(value, expr), factor);
+    }
+    expr.add_to(result, factor);
+    return result;
+  }
+}
+#endif  // _GLUCAT_LAZY_EXPR_H
@@ -35,6 +35,8 @@
 #include <boost/numeric/ublas/fwd.hpp>
 
 #include <complex>
+#include <cstddef>
+#include <vector>
 
 namespace glucat
 {
@@ -96,6 +98,19 @@ namespace glucat
     sparse_prod(const ublas::matrix_expression<LHS_T>& lhs,
                 const ublas::matrix_expression<RHS_T>& rhs);
 
+    /// Product of matrices, added to result, or assigned to result if init is true
+    template< typename LHS_T, typename RHS_T, typename Result_T >
+    void
+    block_prod(const LHS_T& lhs, const RHS_T& rhs, Result_T& result, const bool init);
+
+    /// Product of dense matrices, added to result, or assigned to result if init is true
+    template< typename Scalar_T, typename Orientation_T, typename Array_T >
+    void
+    block_prod(const ublas::matrix<Scalar_T,Orientation_T,Array_T>& lhs,
+               const ublas::matrix<Scalar_T,Orientation_T,Array_T>& rhs,
+                     ublas::matrix<Scalar_T,Orientation_T,Array_T>& result,
+               const bool init);
+
     /// Product of matrices
     template< typename LHS_T, typename RHS_T >
     const
@@ -141,6 +156,66 @@ namespace glucat
     template< typename Matrix_T >
     eig_genus<Matrix_T>
     classify_eigenvalues(const Matrix_T& val);
+
+    /// Classify the eigenvalues lambda of a matrix of type Matrix_T
+    template< typename Matrix_T >
+    eig_genus<Matrix_T>
+    classify_eigenvalues(const ublas::vector< std::complex<double> >& lambda);
+
+    /// Signed permutation matrix, stored as a column index and a sign for each row
+    // Row i has a single non-zero entry, sign(i), in column col(i).
+    // This takes much less space than a sparse matrix, and the kernels below
+    // use the column indices directly rather than iterating over a sparse matrix.
+    class signed_perm
+    {
+    public:
+      typedef unsigned int size_type;
+
+      /// Unit matrix of dimension dim
+      explicit signed_perm(const size_type dim = 0);
+      /// Signed permutation matrix with the entries of mtx, a monomial matrix with entries +1 or -1
+      template< typename Matrix_T >
+      explicit signed_perm(const ublas::matrix_expression<Matrix_T>& mtx);
+      /// Signed permutation matrix from dim packed rows, each a column with the sign in its top bit
+      signed_perm(const size_type dim, const size_type* packed);
+
+      /// Dimension
+      size_type size() const;
+      /// Column of the non-zero entry of row
+      size_type col(const size_type row) const;
+      /// Is the non-zero entry of row negative?
+      bool      is_negative(const size_type row) const;
+      /// Non-zero entry of row
+      int       sign(const size_type row) const;
+      /// Estimated number of bytes used by the column indices and signs
+      std::size_t bytes() const;
+      /// Write the dim packed rows, each a column with the sign in its top bit
+      void      pack(size_type* packed) const;
+      /// Top bit of a packed row, set if its non-zero entry is negative
+      static const size_type packed_sign_bit = ~(~size_type(0) >> 1);
+    private:
+      friend const signed_perm signed_perm_prod(const signed_perm& lhs, const signed_perm& rhs);
+
+      /// Column of the non-zero entry of each row
+      std::vector<size_type> m_col;
+      /// Bit mask of the rows whose non-zero entry is negative
+      std::vector<bool>      m_neg;
+    };
+
+    /// Product of signed permutation matrices
+    const
+    signed_perm
+    signed_perm_prod(const signed_perm& lhs, const signed_perm& rhs);
+
+    /// Add crd times a signed permutation matrix to a matrix
+    template< typename Matrix_T, typename Scalar_T >
+    void
+    signed_perm_plus_assign(Matrix_T& mtx, const signed_perm& perm, const Scalar_T& crd);
+
+    /// Inner product of a signed permutation matrix and a matrix: sum(x(i,j)*y(i,j))/x.nrows()
+    template< typename Scalar_T, typename RHS_T >
+    Scalar_T
+    signed_perm_inner(const signed_perm& lhs, const RHS_T& rhs);
   }
 }
 
@@ -0,0 +1,192 @@
+#ifndef _GLUCAT_MATRIX_BACKEND_H
+#define _GLUCAT_MATRIX_BACKEND_H
+/***************************************************************************
+    GluCat : Generic library of universal Clifford algebra templates
+    matrix_backend.h : Declare the linear algebra backends used by matrix_multi
+                             -------------------
+    begin                : Sat 2026-10-17
+    copyright            : (C) 2001-2016 by Paul C. Leopardi
+ ***************************************************************************
+
+    This library is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published
+    by the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with this library.  If not, see <http://www.gnu.org/licenses/>.
+
+ ***************************************************************************
+ This library is based on a prototype written by Arvind Raja and was
+ licensed under the LGPL with permission of the author. See Arvind Raja,
+ "Object-oriented implementations of Clifford algebras in C++: a prototype",
+ in Ablamowicz, Lounesto and Parra (eds.)
+ "Clifford algebras with numeric and symbolic computations, Birkhauser, 1996."
+ ***************************************************************************
+ See also Arvind Raja's original header comments and references in glucat.h
+ ***************************************************************************/
+
+#include "glucat/matrix.h"
+
+#include <boost/numeric/ublas/fwd.hpp>
+
+#include <complex>
+#include <cstddef>
+
+namespace boost { namespace numeric { namespace ublas
+{
+  // Declared in <boost/numeric/ublas/lu.hpp>, which is included by matrix_backend_imp.h
+  template< class T, class A >
+  class permutation_matrix;
+} } }
+
+namespace glucat
+{
+  namespace matrix
+  {
+    // A linear algebra backend is a class with the static member functions below.
+    // matrix_multi<> uses the backend backend_t for its dense linear algebra.
+    // The matrices are ublas::matrix<> in every backend, so that a backend
+    // can be changed without changing the representation of a multivector.
+
+    /// Linear algebra backend using uBLAS, for any scalar type
+    struct ublas_backend
+    {
+      /// Row interchanges of an LU factorization
+      typedef ublas::permutation_matrix< std::size_t, ublas::unbounded_array<std::size_t> > pivot_t;
+
+      /// Name of the backend
+      static const char* name();
+
+      /// Product of matrices, added to result, or assigned to result if init is true
+      template< typename LHS_T, typename RHS_T, typename Result_T >
+      static void prod(const LHS_T& lhs, const RHS_T& rhs, Result_T& result, const bool init);
+
+      /// LU factorization in place, with partial pivoting
+      // Returns 0 if lu is non-singular, otherwise 1 + the index of the first zero pivot.
+      // The layout of the factors belongs to the backend: use them only with lu_substitute().
+      template< typename Matrix_T >
+      static std::size_t lu_factorize(Matrix_T& lu, pivot_t& pivots);
+
+      /// Overwrite rhs with the solution x of a * x == rhs, given the LU factorization of a
+      template< typename Matrix_T >
+      static void lu_substitute(const Matrix_T& lu, const pivot_t& pivots, Matrix_T& rhs);
+      template< typename Scalar_T, typename Array_T >
+      static void lu_substitute(const ublas::matrix<Scalar_T,ublas::row_major,Array_T>& lu,
+                                const pivot_t& pivots,
+                                      ublas::matrix<Scalar_T,ublas::row_major,Array_T>& rhs);
+
+      /// Eigenvalues of a matrix
+      template< typename Matrix_T >
+      static ublas::vector< std::complex<double> > eigenvalues(const Matrix_T& val);
+
+      /// Infinity norm: maximum absolute row sum
+      template< typename Matrix_T >
+      static typename Matrix_T::value_type norm_inf(const Matrix_T& val);
+
+      /// Square of Frobenius norm
+      template< typename Matrix_T >
+      static typename Matrix_T::value_type norm_frob2(const Matrix_T& val);
+
+      /// Real Schur decomposition: on entry t holds a, on exit a == q * t * trans(q)
+      // q is orthogonal and t is quasi upper triangular, with a 1x1 diagonal block for
+      // each real eigenvalue and a 2x2 diagonal block for each complex conjugate pair.
+      // Entries of t below its diagonal blocks are zero.
+      // Returns false if the QR algorithm does not converge.
+      template< typename Scalar_T, typename Array_T >
+      static bool real_schur(ublas::matrix<Scalar_T,ublas::row_major,Array_T>& t,
+                             ublas::matrix<Scalar_T,ublas::row_major,Array_T>& q);
+    };
+
+#if defined(_GLUCAT_USE_LAPACK)
+    /// Linear algebra backend using the system BLAS and LAPACK libraries
+    // Matrices of float and double use BLAS and LAPACK. Matrices of other scalar types,
+    // such as long double, dd_real and qd_real, use the members of ublas_backend.
+    struct lapack_backend : public ublas_backend
+    {
+      using ublas_backend::prod;
+      using ublas_backend::lu_factorize;
+      using ublas_backend::lu_substitute;
+      using ublas_backend::real_schur;
+
+      /// Name of the backend
+      static const char* name();
+
+      /// Product of matrices, added to result, or assigned to result if init is true
+      template< typename Array_T >
+      static void prod(const ublas::matrix<double,ublas::row_major,Array_T>& lhs,
+                       const ublas::matrix<double,ublas::row_major,Array_T>& rhs,
+                             ublas::matrix<double,ublas::row_major,Array_T>& result,
+                       const bool init);
+      template< typename Array_T >
+      static void prod(const ublas::matrix<float,ublas::row_major,Array_T>& lhs,
+                       const ublas::matrix<float,ublas::row_major,Array_T>& rhs,
+                             ublas::matrix<float,ublas::row_major,Array_T>& result,
+                       const bool init);
+
+      /// LU factorization in place, with partial pivoting
+      template< typename Array_T >
+      static std::size_t lu_factorize(ublas::matrix<double,ublas::row_major,Array_T>& lu, pivot_t& pivots);
+      template< typename Array_T >
+      static std::size_t lu_factorize(ublas::matrix<float,ublas::row_major,Array_T>& lu, pivot_t& pivots);
+
+      /// Overwrite rhs with the solution x of a * x == rhs, given the LU factorization of a
+      template< typename Array_T >
+      static void lu_substitute(const ublas::matrix<double,ublas::row_major,Array_T>& lu,
+                                const pivot_t& pivots,
+                                      ublas::matrix<double,ublas::row_major,Array_T>& rhs);
+      template< typename Array_T >
+      static void lu_substitute(const ublas::matrix<float,ublas::row_major,Array_T>& lu,
+                                const pivot_t& pivots,
+                                      ublas::matrix<float,ublas::row_major,Array_T>& rhs);
+
+      /// Eigenvalues of a matrix, via the real Schur form computed by LAPACK dgees
+      template< typename Matrix_T >
+      static ublas::vector< std::complex<double> > eigenvalues(const Matrix_T& val);
+
+      /// Real Schur decomposition of a matrix of double, via LAPACK dgees
+      template< typename Array_T >
+      static bool real_schur(ublas::matrix<double,ublas::row_major,Array_T>& t,
+                             ublas::matrix<double,ublas::row_major,Array_T>& q);
+    private:
+      /// Product of matrices of float or double, via BLAS gemm
+      template< typename Scalar_T, typename Array_T >
+      static void lapack_prod(const ublas::matrix<Scalar_T,ublas::row_major,Array_T>& lhs,
+                              const ublas::matrix<Scalar_T,ublas::row_major,Array_T>& rhs,
+                                    ublas::matrix<Scalar_T,ublas::row_major,Array_T>& result,
+                              const bool init);
+      /// LU factorization of a matrix of float or double, via LAPACK getrf
+      template< typename Scalar_T, typename Array_T >
+      static std::size_t lapack_lu_factorize(ublas::matrix<Scalar_T,ublas::row_major,Array_T>& lu,
+                                             pivot_t& pivots);
+      /// LU substitution for a matrix of float or double, via LAPACK getrs
+      template< typename Scalar_T, typename Array_T >
+      static void lapack_lu_substitute(const ublas::matrix<Scalar_T,ublas::row_major,Array_T>& lu,
+                                       const pivot_t& pivots,
+                                             ublas::matrix<Scalar_T,ublas::row_major,Array_T>& rhs);
+    };
+
+    /// Linear algebra backend used by matrix_multi<>
+    typedef lapack_backend backend_t;
+#else
+    /// Linear algebra backend used by matrix_multi<>
+    typedef ublas_backend  backend_t;
+#endif
+
+    /// Product of matrices which commute with unit_i, a signed permutation matrix with square -1
+    // Such matrices are complex matrices of half the dimension, with unit_i as the imaginary unit.
+    // The product is formed in complex arithmetic, using four real products of half the dimension.
+    template< typename Scalar_T, typename Orientation_T, typename Array_T >
+    void
+    complex_prod(const ublas::matrix<Scalar_T,Orientation_T,Array_T>& lhs,
+                 const ublas::matrix<Scalar_T,Orientation_T,Array_T>& rhs,
+                 const signed_perm& unit_i,
+                       ublas::matrix<Scalar_T,Orientation_T,Array_T>& result);
+  }
+}
+#endif  // _GLUCAT_MATRIX_BACKEND_H
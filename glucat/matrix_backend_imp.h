@@ -0,0 +1,1092 @@
+#ifndef _GLUCAT_MATRIX_BACKEND_IMP_H
+#define _GLUCAT_MATRIX_BACKEND_IMP_H
+/***************************************************************************
+    GluCat : Generic library of universal Clifford algebra templates
+    matrix_backend_imp.h : Implement the linear algebra backends used by matrix_multi
+                             -------------------
+    begin                : Sat 2026-10-17
+    copyright            : (C) 2001-2016 by Paul C. Leopardi
+ ***************************************************************************
+
+    This library is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published
+    by the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with this library.  If not, see <http://www.gnu.org/licenses/>.
+
+ ***************************************************************************
+ This library is based on a prototype written by Arvind Raja and was
+ licensed under the LGPL with permission of the author. See Arvind Raja,
+ "Object-oriented implementations of Clifford algebras in C++: a prototype",
+ in Ablamowicz, Lounesto and Parra (eds.)
+ "Clifford algebras with numeric and symbolic computations, Birkhauser, 1996."
+ ***************************************************************************
+ See also Arvind Raja's original header comments and references in glucat.h
+ ***************************************************************************/
+
+#include "glucat/matrix_backend.h"
+#include "glucat/matrix_imp.h"
+
+# if  defined(_GLUCAT_GCC_IGNORE_UNUSED_LOCAL_TYPEDEFS)
+#  pragma GCC diagnostic push
+#  pragma GCC diagnostic ignored "-Wunused-local-typedefs"
+# endif
+#include <boost/numeric/ublas/lu.hpp>
+# if defined(_GLUCAT_GCC_IGNORE_UNUSED_LOCAL_TYPEDEFS)
+#  pragma GCC diagnostic pop
+# endif
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+#if defined(_GLUCAT_USE_LAPACK)
+// Fortran BLAS and LAPACK routines, with the hidden lengths of their character arguments
+extern "C"
+{
+  void sgemm_(const char* transa, const char* transb,
+              const int* m, const int* n, const int* k,
+              const float* alpha, const float* a, const int* lda,
+              const float* b, const int* ldb,
+              const float* beta, float* c, const int* ldc,
+              std::size_t transa_len, std::size_t transb_len);
+  void dgemm_(const char* transa, const char* transb,
+              const int* m, const int* n, const int* k,
+              const double* alpha, const double* a, const int* lda,
+              const double* b, const int* ldb,
+              const double* beta, double* c, const int* ldc,
+              std::size_t transa_len, std::size_t transb_len);
+  void sgetrf_(const int* m, const int* n, float* a, const int* lda, int* ipiv, int* info);
+  void dgetrf_(const int* m, const int* n, double* a, const int* lda, int* ipiv, int* info);
+  void sgetrs_(const char* trans, const int* n, const int* nrhs,
+               const float* a, const int* lda, const int* ipiv,
+               float* b, const int* ldb, int* info,
+               std::size_t trans_len);
+  void dgetrs_(const char* trans, const int* n, const int* nrhs,
+               const double* a, const int* lda, const int* ipiv,
+               double* b, const int* ldb, int* info,
+               std::size_t trans_len);
+  void dgees_(const char* jobvs, const char* sort, int (*select)(const double*, const double*),
+              const int* n, double* a, const int* lda, int* sdim,
+              double* wr, double* wi, double* vs, const int* ldvs,
+              double* work, const int* lwork, int* bwork, int* info,
+              std::size_t jobvs_len, std::size_t sort_len);
+}
+#endif
+
+namespace glucat { namespace matrix
+{
+  /// Name of the backend
+  inline
+  const char*
+  ublas_backend::
+  name()
+  { return "ublas"; }
+
+  /// Product of matrices, added to result, or assigned to result if init is true
+  template< typename LHS_T, typename RHS_T, typename Result_T >
+  inline
+  void
+  ublas_backend::
+  prod(const LHS_T& lhs, const RHS_T& rhs, Result_T& result, const bool init)
+  { block_prod(lhs, rhs, result, init); }
+
+  /// LU factorization in place, with partial pivoting
+  template< typename Matrix_T >
+  inline
+  std::size_t
+  ublas_backend::
+  lu_factorize(Matrix_T& lu, pivot_t& pivots)
+  { return ublas::lu_factorize(lu, pivots); }
+
+  /// Overwrite rhs with the solution x of a * x == rhs, given the LU factorization of a
+  template< typename Matrix_T >
+  inline
+  void
+  ublas_backend::
+  lu_substitute(const Matrix_T& lu, const pivot_t& pivots, Matrix_T& rhs)
+  { ublas::lu_substitute(lu, pivots, rhs); }
+
+  /// Subtract from row x the sum of coeff[j] times row_j, for j from 0 to nbr_rows-1, in that order
+  // Rows are subtracted four at a time, so that x is loaded and stored once for every four rows.
+  template< typename Scalar_T, typename Index_T >
+  void
+  lu_subtract_rows(Scalar_T* x, const Index_T nbr_cols,
+                   const Scalar_T* const* row, const Scalar_T* coeff, const Index_T nbr_rows)
+  {
+    Index_T j = 0;
+    for (;
+        j + 4 <= nbr_rows;
+        j += 4)
+    {
+      const Scalar_T* y0 = row[j];
+      const Scalar_T* y1 = row[j + 1];
+      const Scalar_T* y2 = row[j + 2];
+      const Scalar_T* y3 = row[j + 3];
+      const Scalar_T c0 = coeff[j];
+      const Scalar_T c1 = coeff[j + 1];
+      const Scalar_T c2 = coeff[j + 2];
+      const Scalar_T c3 = coeff[j + 3];
+      for (Index_T
+          col = 0;
+          col != nbr_cols;
+          ++col)
+        x[col] = (((x[col] - c0 * y0[col]) - c1 * y1[col]) - c2 * y2[col]) - c3 * y3[col];
+    }
+    for (;
+        j != nbr_rows;
+        ++j)
+    {
+      const Scalar_T* y = row[j];
+      const Scalar_T c = coeff[j];
+      for (Index_T
+          col = 0;
+          col != nbr_cols;
+          ++col)
+        x[col] -= c * y[col];
+    }
+  }
+
+  // For a dense row major rhs, the substitutions update whole rows of rhs, which are
+  // contiguous, so that many columns, such as a batch of right hand sides, are solved
+  // quickly. Each entry is updated in the same order as by ublas::lu_substitute(),
+  // and zero entries of the factors are skipped.
+  template< typename Scalar_T, typename Array_T >
+  void
+  ublas_backend::
+  lu_substitute(const ublas::matrix<Scalar_T,ublas::row_major,Array_T>& lu,
+                const pivot_t& pivots,
+                      ublas::matrix<Scalar_T,ublas::row_major,Array_T>& rhs)
+  {
+    typedef typename ublas::matrix<Scalar_T,ublas::row_major,Array_T>::size_type matrix_index_t;
+
+    const matrix_index_t dim = lu.size1();
+    const matrix_index_t nbr_cols = rhs.size2();
+    if (dim == 0 || nbr_cols == 0)
+      return;
+    Scalar_T* rhs_data = &(rhs.data()[0]);
+
+    // Row interchanges
+    for (matrix_index_t
+        row = 0;
+        row != dim;
+        ++row)
+      if (pivots(row) != row)
+        std::swap_ranges(rhs_data + row * nbr_cols,
+                         rhs_data + (row + 1) * nbr_cols,
+                         rhs_data + pivots(row) * nbr_cols);
+
+    // Rows of rhs and non-zero entries of the factors used to update each row
+    std::vector<const Scalar_T*> rows(dim);
+    std::vector<Scalar_T> coeff(dim);
+
+    // Forward substitution with the unit lower triangular factor
+    for (matrix_index_t
+        row = 1;
+        row < dim;
+        ++row)
+    {
+      matrix_index_t nbr_rows = 0;
+      for (matrix_index_t
+          k = 0;
+          k != row;
+          ++k)
+        if (lu(row, k) != Scalar_T(0))
+        {
+          rows[nbr_rows] = rhs_data + k * nbr_cols;
+          coeff[nbr_rows] = lu(row, k);
+          ++nbr_rows;
+        }
+      lu_subtract_rows(rhs_data + row * nbr_cols, nbr_cols, &rows[0], &coeff[0], nbr_rows);
+    }
+
+    // Back substitution with the upper triangular factor
+    for (matrix_index_t
+        row = dim;
+        row-- != 0;
+        )
+    {
+      matrix_index_t nbr_rows = 0;
+      for (matrix_index_t
+          k = dim - 1;
+          k > row;
+          --k)
+        if (lu(row, k) != Scalar_T(0))
+        {
+          rows[nbr_rows] = rhs_data + k * nbr_cols;
+          coeff[nbr_rows] = lu(row, k);
+          ++nbr_rows;
+        }
+      Scalar_T* x = rhs_data + row * nbr_cols;
+      lu_subtract_rows(x, nbr_cols, &rows[0], &coeff[0], nbr_rows);
+      const Scalar_T lu_row_row = lu(row, row);
+      for (matrix_index_t
+          col = 0;
+          col != nbr_cols;
+          ++col)
+        x[col] /= lu_row_row;
+    }
+  }
+
+  /// Eigenvalues of a matrix
+  // Without _GLUCAT_USE_BINDINGS, uBLAS cannot find eigenvalues, and the result is zero.
+  template< typename Matrix_T >
+  ublas::vector< std::complex<double> >
+  ublas_backend::
+  eigenvalues(const Matrix_T& val)
+  {
+    typedef std::complex<double> complex_t;
+    typedef typename ublas::vector<complex_t> complex_vector_t;
+    typedef typename Matrix_T::size_type matrix_index_t;
+
+    const matrix_index_t dim = val.size1();
+    complex_vector_t lambda = complex_vector_t(dim);
+    lambda.clear();
+
+#if defined(_GLUCAT_USE_BINDINGS)
+    namespace lapack = boost::numeric::bindings::lapack;
+    typedef typename ublas::matrix<double, ublas::column_major> lapack_matrix_t;
+
+    lapack_matrix_t T = to_lapack(val);
+    lapack_matrix_t V = T;
+    typedef typename ublas::vector<double> vector_t;
+    vector_t real_lambda = vector_t(dim);
+    vector_t imag_lambda = vector_t(dim);
+    fortran_int_t sdim = 0;
+
+    lapack::gees ('N', 'N', (external_fp)0, T, sdim, real_lambda, imag_lambda, V );
+
+    lambda.clear();
+    for (vector_t::size_type  k=0; k!= dim; ++k)
+      lambda[k] = complex_t(real_lambda[k], imag_lambda[k]);
+#endif
+    return lambda;
+  }
+
+  /// Infinity norm: maximum absolute row sum
+  template< typename Matrix_T >
+  inline
+  typename Matrix_T::value_type
+  ublas_backend::
+  norm_inf(const Matrix_T& val)
+  { return ublas::norm_inf(val); }
+
+  /// Square of Frobenius norm
+  template< typename Matrix_T >
+  inline
+  typename Matrix_T::value_type
+  ublas_backend::
+  norm_frob2(const Matrix_T& val)
+  { return matrix::norm_frob2(val); }
+
+  /// Real Schur decomposition: on entry t holds a, on exit a == q * t * trans(q)
+  // Householder reduction to upper Hessenberg form, then the Francis double shift
+  // QR algorithm, with the transformations accumulated in q.
+  // Reference: [GL], Sections 7.4 and 7.5
+  // This follows the procedures orthes and hqr2 of EISPACK, as in the JAMA package,
+  // without the back substitution for eigenvectors.
+  template< typename Scalar_T, typename Array_T >
+  bool
+  ublas_backend::
+  real_schur(ublas::matrix<Scalar_T,ublas::row_major,Array_T>& t,
+             ublas::matrix<Scalar_T,ublas::row_major,Array_T>& q)
+  {
+    typedef numeric_traits<Scalar_T> traits_t;
+    typedef ublas::matrix<Scalar_T,ublas::row_major,Array_T> matrix_t;
+
+    const index_t nn = index_t(t.size1());
+    q = ublas::identity_matrix<Scalar_T>(nn);
+    if (nn == 0)
+      return true;
+    matrix_t& h = t;
+    const index_t high = nn - 1;
+
+    // Reduce to upper Hessenberg form
+    std::vector<Scalar_T> ort(nn, Scalar_T(0));
+    for (index_t
+        m = 1;
+        m < high;
+        ++m)
+    {
+      Scalar_T scale = Scalar_T(0);
+      for (index_t
+          i = m;
+          i <= high;
+          ++i)
+        scale += traits_t::abs(h(i, m-1));
+      if (scale != Scalar_T(0))
+      {
+        Scalar_T hh = Scalar_T(0);
+        for (index_t
+            i = high;
+            i >= m;
+            --i)
+        {
+          ort[i] = h(i, m-1) / scale;
+          hh += ort[i] * ort[i];
+        }
+        Scalar_T g = traits_t::sqrt(hh);
+        if (ort[m] > Scalar_T(0))
+          g = -g;
+        hh -= ort[m] * g;
+        ort[m] -= g;
+
+        // Apply the Householder similarity transformation h = (I-u*u'/hh)*h*(I-u*u'/hh)
+        for (index_t
+            j = m;
+            j != nn;
+            ++j)
+        {
+          Scalar_T f = Scalar_T(0);
+          for (index_t
+              i = high;
+              i >= m;
+              --i)
+            f += ort[i] * h(i, j);
+          f /= hh;
+          for (index_t
+              i = m;
+              i <= high;
+              ++i)
+            h(i, j) -= f * ort[i];
+        }
+        for (index_t
+            i = 0;
+            i <= high;
+            ++i)
+        {
+          Scalar_T f = Scalar_T(0);
+          for (index_t
+              j = high;
+              j >= m;
+              --j)
+            f += ort[j] * h(i, j);
+          f /= hh;
+          for (index_t
+              j = m;
+              j <= high;
+              ++j)
+            h(i, j) -= f * ort[j];
+        }
+        ort[m] *= scale;
+        h(m, m-1) = scale * g;
+      }
+    }
+
+    // Accumulate the transformations
+    for (index_t
+        m = high - 1;
+        m >= 1;
+        --m)
+      if (h(m, m-1) != Scalar_T(0))
+      {
+        for (index_t
+            i = m + 1;
+            i <= high;
+            ++i)
+          ort[i] = h(i, m-1);
+        for (index_t
+            j = m;
+            j <= high;
+            ++j)
+        {
+          Scalar_T g = Scalar_T(0);
+          for (index_t
+              i = m;
+              i <= high;
+              ++i)
+            g += ort[i] * q(i, j);
+          // Double division avoids possible underflow
+          g = (g / ort[m]) / h(m, m-1);
+          for (index_t
+              i = m;
+              i <= high;
+              ++i)
+            q(i, j) += g * ort[i];
+        }
+      }
+    for (index_t
+        i = 2;
+        i < nn;
+        ++i)
+      for (index_t
+          j = 0;
+          j < i - 1;
+          ++j)
+        h(i, j) = Scalar_T(0);
+
+    // Reduce the Hessenberg form to real Schur form
+    static const Scalar_T eps = std::numeric_limits<Scalar_T>::epsilon();
+    const index_t max_iter = 30 * nn;
+    Scalar_T norm = Scalar_T(0);
+    for (index_t
+        i = 0;
+        i != nn;
+        ++i)
+      for (index_t
+          j = std::max(i - 1, 0);
+          j != nn;
+          ++j)
+        norm += traits_t::abs(h(i, j));
+
+    Scalar_T exshift = Scalar_T(0);
+    Scalar_T p = Scalar_T(0);
+    Scalar_T qq = Scalar_T(0);
+    Scalar_T r = Scalar_T(0);
+    Scalar_T s = Scalar_T(0);
+    Scalar_T z = Scalar_T(0);
+    Scalar_T w;
+    Scalar_T x;
+    Scalar_T y;
+    index_t iter = 0;
+    index_t total_iter = 0;
+    index_t n = high;
+    while (n >= 0)
+    {
+      // Look for a single small subdiagonal element
+      index_t l = n;
+      for (;
+          l > 0;
+          --l)
+      {
+        s = traits_t::abs(h(l-1, l-1)) + traits_t::abs(h(l, l));
+        if (s == Scalar_T(0))
+          s = norm;
+        if (traits_t::abs(h(l, l-1)) < eps * s)
+          break;
+      }
+      if (l > 0)
+        h(l, l-1) = Scalar_T(0);
+
+      if (l == n)
+      { // One root found
+        h(n, n) += exshift;
+        --n;
+        iter = 0;
+      }
+      else if (l == n - 1)
+      { // Two roots found
+        w = h(n, n-1) * h(n-1, n);
+        p = (h(n-1, n-1) - h(n, n)) / Scalar_T(2);
+        qq = p * p + w;
+        z = traits_t::sqrt(traits_t::abs(qq));
+        h(n, n) += exshift;
+        h(n-1, n-1) += exshift;
+        if (qq >= Scalar_T(0))
+        { // Real pair: rotate the block to upper triangular form
+          z = (p >= Scalar_T(0)) ? p + z : p - z;
+          x = h(n, n-1);
+          s = traits_t::abs(x) + traits_t::abs(z);
+          p = x / s;
+          qq = z / s;
+          r = traits_t::sqrt(p * p + qq * qq);
+          p /= r;
+          qq /= r;
+          for (index_t
+              j = n - 1;
+              j != nn;
+              ++j)
+          {
+            z = h(n-1, j);
+            h(n-1, j) = qq * z + p * h(n, j);
+            h(n, j) = qq * h(n, j) - p * z;
+          }
+          for (index_t
+              i = 0;
+              i <= n;
+              ++i)
+          {
+            z = h(i, n-1);
+            h(i, n-1) = qq * z + p * h(i, n);
+            h(i, n) = qq * h(i, n) - p * z;
+          }
+          for (index_t
+              i = 0;
+              i <= high;
+              ++i)
+          {
+            z = q(i, n-1);
+            q(i, n-1) = qq * z + p * q(i, n);
+            q(i, n) = qq * q(i, n) - p * z;
+          }
+          h(n, n-1) = Scalar_T(0);
+        }
+        n -= 2;
+        iter = 0;
+      }
+      else
+      { // No convergence yet
+        if (total_iter == max_iter)
+          return false;
+        x = h(n, n);
+        y = Scalar_T(0);
+        w = Scalar_T(0);
+        if (l < n)
+        {
+          y = h(n-1, n-1);
+          w = h(n, n-1) * h(n-1, n);
+        }
+
+        // Wilkinson's original ad hoc shift
+        if (iter == 10)
+        {
+          exshift += x;
+          for (index_t
+              i = 0;
+              i <= n;
+              ++i)
+            h(i, i) -= x;
+          s = traits_t::abs(h(n, n-1)) + traits_t::abs(h(n-1, n-2));
+          x = y = Scalar_T(0.75) * s;
+          w = Scalar_T(-0.4375) * s * s;
+        }
+
+        // MATLAB's new ad hoc shift
+        if (iter == 30)
+        {
+          s = (y - x) / Scalar_T(2);
+          s = s * s + w;
+          if (s > Scalar_T(0))
+          {
+            s = traits_t::sqrt(s);
+            if (y < x)
+              s = -s;
+            s = x - w / ((y - x) / Scalar_T(2) + s);
+            for (index_t
+                i = 0;
+                i <= n;
+                ++i)
+              h(i, i) -= s;
+            exshift += s;
+            x = y = w = Scalar_T(0.964);
+          }
+        }
+        ++iter;
+        ++total_iter;
+
+        // Look for two consecutive small subdiagonal elements
+        index_t m = n - 2;
+        for (;
+            m >= l;
+            --m)
+        {
+          z = h(m, m);
+          r = x - z;
+          s = y - z;
+          p = (r * s - w) / h(m+1, m) + h(m, m+1);
+          qq = h(m+1, m+1) - z - r - s;
+          r = h(m+2, m+1);
+          s = traits_t::abs(p) + traits_t::abs(qq) + traits_t::abs(r);
+          p /= s;
+          qq /= s;
+          r /= s;
+          if (m == l)
+            break;
+          if (traits_t::abs(h(m, m-1)) * (traits_t::abs(qq) + traits_t::abs(r)) <
+              eps * (traits_t::abs(p) * (traits_t::abs(h(m-1, m-1)) + traits_t::abs(z) + traits_t::abs(h(m+1, m+1)))))
+            break;
+        }
+        for (index_t
+            i = m + 2;
+            i <= n;
+            ++i)
+        {
+          h(i, i-2) = Scalar_T(0);
+          if (i > m + 2)
+            h(i, i-3) = Scalar_T(0);
+        }
+
+        // Double QR step involving rows l to n and columns m to n
+        for (index_t
+            k = m;
+            k <= n - 1;
+            ++k)
+        {
+          const bool notlast = (k != n - 1);
+          if (k != m)
+          {
+            p = h(k, k-1);
+            qq = h(k+1, k-1);
+            r = notlast ? h(k+2, k-1) : Scalar_T(0);
+            x = traits_t::abs(p) + traits_t::abs(qq) + traits_t::abs(r);
+            if (x == Scalar_T(0))
+              continue;
+            p /= x;
+            qq /= x;
+            r /= x;
+          }
+          s = traits_t::sqrt(p * p + qq * qq + r * r);
+          if (p < Scalar_T(0))
+            s = -s;
+          if (s != Scalar_T(0))
+          {
+            if (k != m)
+              h(k, k-1) = -s * x;
+            else if (l != m)
+              h(k, k-1) = -h(k, k-1);
+            p += s;
+            x = p / s;
+            y = qq / s;
+            z = r / s;
+            qq /= p;
+            r /= p;
+
+            // Row modification
+            for (index_t
+                j = k;
+                j != nn;
+                ++j)
+            {
+              p = h(k, j) + qq * h(k+1, j);
+              if (notlast)
+              {
+                p += r * h(k+2, j);
+                h(k+2, j) -= p * z;
+              }
+              h(k, j) -= p * x;
+              h(k+1, j) -= p * y;
+            }
+
+            // Column modification
+            const index_t i_max = std::min(n, k + 3);
+            for (index_t
+                i = 0;
+                i <= i_max;
+                ++i)
+            {
+              p = x * h(i, k) + y * h(i, k+1);
+              if (notlast)
+              {
+                p += z * h(i, k+2);
+                h(i, k+2) -= p * r;
+              }
+              h(i, k) -= p;
+              h(i, k+1) -= p * qq;
+            }
+
+            // Accumulate transformations
+            for (index_t
+                i = 0;
+                i <= high;
+                ++i)
+            {
+              p = x * q(i, k) + y * q(i, k+1);
+              if (notlast)
+              {
+                p += z * q(i, k+2);
+                q(i, k+2) -= p * r;
+              }
+              q(i, k) -= p;
+              q(i, k+1) -= p * qq;
+            }
+          }
+        }
+      }
+    }
+    // The double QR steps treat the bulge below the subdiagonal as zero without clearing it
+    for (index_t
+        i = 2;
+        i < nn;
+        ++i)
+      for (index_t
+          j = 0;
+          j < i - 1;
+          ++j)
+        h(i, j) = Scalar_T(0);
+    return true;
+  }
+
+#if defined(_GLUCAT_USE_LAPACK)
+  /// BLAS and LAPACK routines for each scalar type
+  template< typename Scalar_T >
+  struct lapack_routines;
+
+  template< >
+  struct lapack_routines<float>
+  {
+    static void gemm(const int m, const int n, const int k,
+                     const float* a, const float* b, const float beta, float* c)
+    {
+      const float alpha = 1.0f;
+      sgemm_("N", "N", &m, &n, &k, &alpha, a, &m, b, &k, &beta, c, &m, 1, 1);
+    }
+    static void getrf(const int n, float* a, int* ipiv, int* info)
+    { sgetrf_(&n, &n, a, &n, ipiv, info); }
+    static void getrs(const char* trans, const int n, const int nrhs,
+                      const float* a, const int* ipiv, float* b, int* info)
+    { sgetrs_(trans, &n, &nrhs, a, &n, ipiv, b, &n, info, 1); }
+  };
+
+  template< >
+  struct lapack_routines<double>
+  {
+    static void gemm(const int m, const int n, const int k,
+                     const double* a, const double* b, const double beta, double* c)
+    {
+      const double alpha = 1.0;
+      dgemm_("N", "N", &m, &n, &k, &alpha, a, &m, b, &k, &beta, c, &m, 1, 1);
+    }
+    static void getrf(const int n, double* a, int* ipiv, int* info)
+    { dgetrf_(&n, &n, a, &n, ipiv, info); }
+    static void getrs(const char* trans, const int n, const int nrhs,
+                      const double* a, const int* ipiv, double* b, int* info)
+    { dgetrs_(trans, &n, &nrhs, a, &n, ipiv, b, &n, info, 1); }
+  };
+
+  /// Name of the backend
+  inline
+  const char*
+  lapack_backend::
+  name()
+  { return "lapack"; }
+
+  /// Product of matrices, added to result, or assigned to result if init is true
+  template< typename Array_T >
+  inline
+  void
+  lapack_backend::
+  prod(const ublas::matrix<double,ublas::row_major,Array_T>& lhs,
+       const ublas::matrix<double,ublas::row_major,Array_T>& rhs,
+             ublas::matrix<double,ublas::row_major,Array_T>& result,
+       const bool init)
+  { lapack_prod(lhs, rhs, result, init); }
+
+  template< typename Array_T >
+  inline
+  void
+  lapack_backend::
+  prod(const ublas::matrix<float,ublas::row_major,Array_T>& lhs,
+       const ublas::matrix<float,ublas::row_major,Array_T>& rhs,
+             ublas::matrix<float,ublas::row_major,Array_T>& result,
+       const bool init)
+  { lapack_prod(lhs, rhs, result, init); }
+
+  /// LU factorization in place, with partial pivoting
+  template< typename Array_T >
+  inline
+  std::size_t
+  lapack_backend::
+  lu_factorize(ublas::matrix<double,ublas::row_major,Array_T>& lu, pivot_t& pivots)
+  { return lapack_lu_factorize(lu, pivots); }
+
+  template< typename Array_T >
+  inline
+  std::size_t
+  lapack_backend::
+  lu_factorize(ublas::matrix<float,ublas::row_major,Array_T>& lu, pivot_t& pivots)
+  { return lapack_lu_factorize(lu, pivots); }
+
+  /// Overwrite rhs with the solution x of a * x == rhs, given the LU factorization of a
+  template< typename Array_T >
+  inline
+  void
+  lapack_backend::
+  lu_substitute(const ublas::matrix<double,ublas::row_major,Array_T>& lu,
+                const pivot_t& pivots,
+                      ublas::matrix<double,ublas::row_major,Array_T>& rhs)
+  { lapack_lu_substitute(lu, pivots, rhs); }
+
+  template< typename Array_T >
+  inline
+  void
+  lapack_backend::
+  lu_substitute(const ublas::matrix<float,ublas::row_major,Array_T>& lu,
+                const pivot_t& pivots,
+                      ublas::matrix<float,ublas::row_major,Array_T>& rhs)
+  { lapack_lu_substitute(lu, pivots, rhs); }
+
+  /// Product of matrices of float or double, via BLAS gemm
+  // BLAS uses column major arrays, and the row major array of a matrix is the column
+  // major array of its transpose, so trans(result) = trans(rhs) * trans(lhs) is computed.
+  template< typename Scalar_T, typename Array_T >
+  void
+  lapack_backend::
+  lapack_prod(const ublas::matrix<Scalar_T,ublas::row_major,Array_T>& lhs,
+              const ublas::matrix<Scalar_T,ublas::row_major,Array_T>& rhs,
+                    ublas::matrix<Scalar_T,ublas::row_major,Array_T>& result,
+              const bool init)
+  {
+    const int nbr_rows = int(lhs.size1());
+    const int depth    = int(lhs.size2());
+    const int nbr_cols = int(rhs.size2());
+    if (nbr_rows == 0 || nbr_cols == 0)
+      return;
+    if (depth == 0)
+    {
+      if (init)
+        result.clear();
+      return;
+    }
+    lapack_routines<Scalar_T>::gemm(nbr_cols, nbr_rows, depth,
+                                    &(rhs.data()[0]), &(lhs.data()[0]),
+                                    init ? Scalar_T(0) : Scalar_T(1),
+                                    &(result.data()[0]));
+  }
+
+  /// LU factorization of a matrix of float or double, via LAPACK getrf
+  // The row major array of lu is factorized as the column major array of trans(lu),
+  // and lapack_lu_substitute() solves using the transpose of these factors.
+  template< typename Scalar_T, typename Array_T >
+  std::size_t
+  lapack_backend::
+  lapack_lu_factorize(ublas::matrix<Scalar_T,ublas::row_major,Array_T>& lu, pivot_t& pivots)
+  {
+    const int dim = int(lu.size1());
+    if (dim == 0)
+      return 0;
+    std::vector<int> ipiv(dim);
+    int info = 0;
+    lapack_routines<Scalar_T>::getrf(dim, &(lu.data()[0]), &ipiv[0], &info);
+    // LAPACK pivots count from 1
+    for (int
+        k = 0;
+        k != dim;
+        ++k)
+      pivots(k) = std::size_t(ipiv[k] - 1);
+    return (info > 0)
+         ? std::size_t(info)
+         : 0;
+  }
+
+  /// LU substitution for a matrix of float or double, via LAPACK getrs
+  template< typename Scalar_T, typename Array_T >
+  void
+  lapack_backend::
+  lapack_lu_substitute(const ublas::matrix<Scalar_T,ublas::row_major,Array_T>& lu,
+                       const pivot_t& pivots,
+                             ublas::matrix<Scalar_T,ublas::row_major,Array_T>& rhs)
+  {
+    const int dim = int(lu.size1());
+    const int nbr_rhs = int(rhs.size2());
+    if (dim == 0 || nbr_rhs == 0)
+      return;
+    std::vector<int> ipiv(dim);
+    for (int
+        k = 0;
+        k != dim;
+        ++k)
+      ipiv[k] = int(pivots(k)) + 1;
+    // Copy rhs to a column major array, solve, and copy back
+    std::vector<Scalar_T> cols(std::size_t(dim) * nbr_rhs);
+    for (int
+        row = 0;
+        row != dim;
+        ++row)
+      for (int
+          col = 0;
+          col != nbr_rhs;
+          ++col)
+        cols[std::size_t(col) * dim + row] = rhs(row, col);
+    int info = 0;
+    lapack_routines<Scalar_T>::getrs("T", dim, nbr_rhs, &(lu.data()[0]), &ipiv[0], &cols[0], &info);
+    for (int
+        row = 0;
+        row != dim;
+        ++row)
+      for (int
+          col = 0;
+          col != nbr_rhs;
+          ++col)
+        rhs(row, col) = cols[std::size_t(col) * dim + row];
+  }
+
+  /// Eigenvalues of a matrix, via the real Schur form computed by LAPACK dgees
+  template< typename Matrix_T >
+  ublas::vector< std::complex<double> >
+  lapack_backend::
+  eigenvalues(const Matrix_T& val)
+  {
+    typedef std::complex<double> complex_t;
+    typedef typename ublas::vector<complex_t> complex_vector_t;
+
+    const int dim = int(val.size1());
+    complex_vector_t lambda = complex_vector_t(dim);
+    lambda.clear();
+    if (dim == 0)
+      return lambda;
+
+    typedef typename ublas::matrix<double, ublas::column_major> lapack_matrix_t;
+    lapack_matrix_t T = to_lapack(val);
+    std::vector<double> real_lambda(dim);
+    std::vector<double> imag_lambda(dim);
+    double vs = 0.0;
+    const int ldvs = 1;
+    int sdim = 0;
+    int bwork = 0;
+    int info = 0;
+
+    // Query the size of the workspace, then find the eigenvalues
+    int lwork = -1;
+    double work_size = 0.0;
+    dgees_("N", "N", 0, &dim, &(T.data()[0]), &dim, &sdim,
+           &real_lambda[0], &imag_lambda[0], &vs, &ldvs,
+           &work_size, &lwork, &bwork, &info, 1, 1);
+    lwork = std::max(int(work_size), 3 * dim);
+    std::vector<double> work(lwork);
+    dgees_("N", "N", 0, &dim, &(T.data()[0]), &dim, &sdim,
+           &real_lambda[0], &imag_lambda[0], &vs, &ldvs,
+           &work[0], &lwork, &bwork, &info, 1, 1);
+
+    if (info == 0)
+      for (int
+          k = 0;
+          k != dim;
+          ++k)
+        lambda[k] = complex_t(real_lambda[k], imag_lambda[k]);
+    return lambda;
+  }
+
+  /// Real Schur decomposition of a matrix of double, via LAPACK dgees
+  template< typename Array_T >
+  bool
+  lapack_backend::
+  real_schur(ublas::matrix<double,ublas::row_major,Array_T>& t,
+             ublas::matrix<double,ublas::row_major,Array_T>& q)
+  {
+    const int dim = int(t.size1());
+    q = ublas::identity_matrix<double>(dim);
+    if (dim == 0)
+      return true;
+
+    // LAPACK uses column major storage
+    std::vector<double> a(std::size_t(dim) * dim);
+    for (int
+        row = 0;
+        row != dim;
+        ++row)
+      for (int
+          col = 0;
+          col != dim;
+          ++col)
+        a[std::size_t(col) * dim + row] = t(row, col);
+    std::vector<double> vs(std::size_t(dim) * dim);
+    std::vector<double> real_lambda(dim);
+    std::vector<double> imag_lambda(dim);
+    int sdim = 0;
+    int bwork = 0;
+    int info = 0;
+
+    // Query the size of the workspace, then find the Schur form and Schur vectors
+    int lwork = -1;
+    double work_size = 0.0;
+    dgees_("V", "N", 0, &dim, &a[0], &dim, &sdim,
+           &real_lambda[0], &imag_lambda[0], &vs[0], &dim,
+           &work_size, &lwork, &bwork, &info, 1, 1);
+    lwork = std::max(int(work_size), 3 * dim);
+    std::vector<double> work(lwork);
+    dgees_("V", "N", 0, &dim, &a[0], &dim, &sdim,
+           &real_lambda[0], &imag_lambda[0], &vs[0], &dim,
+           &work[0], &lwork, &bwork, &info, 1, 1);
+    if (info != 0)
+      return false;
+
+    for (int
+        row = 0;
+        row != dim;
+        ++row)
+      for (int
+          col = 0;
+          col != dim;
+          ++col)
+      {
+        t(row, col) = (row > col + 1) ? 0.0 : a[std::size_t(col) * dim + row];
+        q(row, col) = vs[std::size_t(col) * dim + row];
+      }
+    return true;
+  }
+#endif
+
+  /// Product of matrices which commute with unit_i, a signed permutation matrix with square -1
+  // unit_i pairs each row r with the row c == unit_i.col(r), where unit_i(r,c) == s and unit_i(c,r) == -s.
+  // For each pair with r < c, the complex coordinate r + i*(-s)*c gives a complex structure,
+  // so that a matrix mtx which commutes with unit_i is the complex matrix a + i*b, where
+  //   a(r,r') == mtx(r,r') and b(r,r') == -s*mtx(c,r').
+  template< typename Scalar_T, typename Orientation_T, typename Array_T >
+  void
+  complex_prod(const ublas::matrix<Scalar_T,Orientation_T,Array_T>& lhs,
+               const ublas::matrix<Scalar_T,Orientation_T,Array_T>& rhs,
+               const signed_perm& unit_i,
+                     ublas::matrix<Scalar_T,Orientation_T,Array_T>& result)
+  {
+    typedef ublas::matrix<Scalar_T,Orientation_T,Array_T> matrix_t;
+    typedef typename matrix_t::size_type matrix_index_t;
+
+    const matrix_index_t dim = lhs.size1();
+    const matrix_index_t half_dim = dim / 2;
+    std::vector<matrix_index_t> re_row;
+    std::vector<matrix_index_t> im_row;
+    std::vector<Scalar_T> im_sign;
+    re_row.reserve(half_dim);
+    im_row.reserve(half_dim);
+    im_sign.reserve(half_dim);
+    for (matrix_index_t
+        row = 0;
+        row != dim;
+        ++row)
+    {
+      const matrix_index_t col = unit_i.col(row);
+      if (row < col)
+      {
+        re_row.push_back(row);
+        im_row.push_back(col);
+        im_sign.push_back(Scalar_T(-unit_i.sign(row)));
+      }
+    }
+
+    // Real and imaginary parts of lhs and rhs
+    matrix_t lhs_re(half_dim, half_dim);
+    matrix_t lhs_im(half_dim, half_dim);
+    matrix_t rhs_re(half_dim, half_dim);
+    matrix_t rhs_im(half_dim, half_dim);
+    for (matrix_index_t
+        j = 0;
+        j != half_dim;
+        ++j)
+      for (matrix_index_t
+          k = 0;
+          k != half_dim;
+          ++k)
+      {
+        lhs_re(j, k) = lhs(re_row[j], re_row[k]);
+        lhs_im(j, k) = im_sign[j] * lhs(im_row[j], re_row[k]);
+        rhs_re(j, k) = rhs(re_row[j], re_row[k]);
+        rhs_im(j, k) = im_sign[j] * rhs(im_row[j], re_row[k]);
+      }
+
+    // (lhs_re + i*lhs_im) * (rhs_re + i*rhs_im)
+    matrix_t result_re(half_dim, half_dim);
+    matrix_t result_im(half_dim, half_dim);
+    backend_t::prod(lhs_re, rhs_re, result_re, true);
+    backend_t::prod(lhs_re, rhs_im, result_im, true);
+    backend_t::prod(lhs_im, rhs_re, result_im, false);
+    lhs_im *= Scalar_T(-1);
+    backend_t::prod(lhs_im, rhs_im, result_re, false);
+
+    // Columns c of the result are i times columns r, up to sign
+    result.resize(dim, dim, false);
+    for (matrix_index_t
+        j = 0;
+        j != half_dim;
+        ++j)
+      for (matrix_index_t
+          k = 0;
+          k != half_dim;
+          ++k)
+      {
+        const Scalar_T& re = result_re(j, k);
+        const Scalar_T& im = result_im(j, k);
+        result(re_row[j], re_row[k]) = re;
+        result(im_row[j], re_row[k]) = im_sign[j] * im;
+        result(re_row[j], im_row[k]) = -im_sign[k] * im;
+        result(im_row[j], im_row[k]) = im_sign[j] * im_sign[k] * re;
+      }
+  }
+} }
+#endif  // _GLUCAT_MATRIX_BACKEND_IMP_H
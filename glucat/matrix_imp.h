@@ -59,6 +59,9 @@
 #  pragma GCC diagnostic pop
 # endif
 
+#include <boost/type_traits/is_same.hpp>
+
+#include <algorithm>
 #include <set>
 
 namespace glucat { namespace matrix
@@ -368,6 +371,213 @@ namespace glucat { namespace matrix
     return ublas::sparse_prod<expression_t>(lhs(), rhs());
   }
 
+  /// Rows of each tile of the result held in local variables by block_prod()
+  const std::size_t block_prod_tile_rows = 4;
+  /// Maximum columns of each tile of the result held in local variables by block_prod()
+  const std::size_t block_prod_tile_cols = 32;
+  /// Rows of rhs in each block used by block_prod()
+  const std::size_t block_prod_block_depth = 256;
+
+  /// Add the product of a block of lhs and rhs to a tile of block_prod_tile_rows rows of the result
+  // The tile is held in local arrays, so that each element of rhs is loaded once per tile,
+  // and the compiler can vectorize the loop over the Tile_Cols columns of the tile,
+  // whose length it knows, without checking for aliasing.
+  template< typename Scalar_T, const std::size_t Tile_Cols >
+  static
+  void
+  block_prod_tile(const std::size_t mid_begin, const std::size_t mid_end,
+                  const Scalar_T* lhs, const std::size_t lhs_stride,
+                  const Scalar_T* rhs, const std::size_t rhs_stride,
+                        Scalar_T* result, const std::size_t result_stride)
+  {
+    Scalar_T* result_0 = result;
+    Scalar_T* result_1 = result_0 + result_stride;
+    Scalar_T* result_2 = result_1 + result_stride;
+    Scalar_T* result_3 = result_2 + result_stride;
+    Scalar_T tile_0[Tile_Cols];
+    Scalar_T tile_1[Tile_Cols];
+    Scalar_T tile_2[Tile_Cols];
+    Scalar_T tile_3[Tile_Cols];
+    for (std::size_t
+        col = 0;
+        col != Tile_Cols;
+        ++col)
+    {
+      tile_0[col] = result_0[col];
+      tile_1[col] = result_1[col];
+      tile_2[col] = result_2[col];
+      tile_3[col] = result_3[col];
+    }
+    const Scalar_T* lhs_0 = lhs;
+    const Scalar_T* lhs_1 = lhs_0 + lhs_stride;
+    const Scalar_T* lhs_2 = lhs_1 + lhs_stride;
+    const Scalar_T* lhs_3 = lhs_2 + lhs_stride;
+    for (std::size_t
+        mid = mid_begin;
+        mid != mid_end;
+        ++mid)
+    {
+      const Scalar_T lhs_0_mid = lhs_0[mid];
+      const Scalar_T lhs_1_mid = lhs_1[mid];
+      const Scalar_T lhs_2_mid = lhs_2[mid];
+      const Scalar_T lhs_3_mid = lhs_3[mid];
+      const Scalar_T* rhs_mid = rhs + mid * rhs_stride;
+      for (std::size_t
+          col = 0;
+          col != Tile_Cols;
+          ++col)
+      {
+        const Scalar_T rhs_val = rhs_mid[col];
+        tile_0[col] += lhs_0_mid * rhs_val;
+        tile_1[col] += lhs_1_mid * rhs_val;
+        tile_2[col] += lhs_2_mid * rhs_val;
+        tile_3[col] += lhs_3_mid * rhs_val;
+      }
+    }
+    for (std::size_t
+        col = 0;
+        col != Tile_Cols;
+        ++col)
+    {
+      result_0[col] = tile_0[col];
+      result_1[col] = tile_1[col];
+      result_2[col] = tile_2[col];
+      result_3[col] = tile_3[col];
+    }
+  }
+
+  /// Add the product of a block of lhs and rhs to nbr_cols columns of one row of the result
+  template< typename Scalar_T >
+  static
+  void
+  block_prod_row(const std::size_t mid_begin, const std::size_t mid_end, const std::size_t nbr_cols,
+                 const Scalar_T* lhs,
+                 const Scalar_T* rhs, const std::size_t rhs_stride,
+                       Scalar_T* result)
+  {
+    for (std::size_t
+        mid = mid_begin;
+        mid != mid_end;
+        ++mid)
+    {
+      const Scalar_T lhs_mid = lhs[mid];
+      const Scalar_T* rhs_mid = rhs + mid * rhs_stride;
+      for (std::size_t
+          col = 0;
+          col != nbr_cols;
+          ++col)
+        result[col] += lhs_mid * rhs_mid[col];
+    }
+  }
+
+  /// Add the product of row major arrays: result += lhs * rhs
+  // lhs is nbr_rows by depth, rhs is depth by nbr_cols, result is nbr_rows by nbr_cols,
+  // and rows of each array are lhs_stride, rhs_stride and result_stride elements apart.
+  // The depth is split into blocks, and within each block, the result is split into tiles.
+  // The tiles for the same columns are visited one after another, so that the block of rhs
+  // for these columns stays in cache. Since the dimensions of the matrices used by
+  // matrix_multi<> are powers of 2, the tiles are almost always full.
+  // Each element of the result is summed in order of increasing depth, as by
+  // ublas::axpy_prod(), so the result is the same as that of axpy_prod().
+  template< typename Scalar_T >
+  static
+  void
+  block_prod_rows(const std::size_t nbr_rows, const std::size_t depth, const std::size_t nbr_cols,
+                  const Scalar_T* lhs, const std::size_t lhs_stride,
+                  const Scalar_T* rhs, const std::size_t rhs_stride,
+                        Scalar_T* result, const std::size_t result_stride)
+  {
+    const std::size_t tiled_rows = nbr_rows - nbr_rows % block_prod_tile_rows;
+    for (std::size_t
+        mid_begin = 0;
+        mid_begin < depth;
+        mid_begin += block_prod_block_depth)
+    {
+      const std::size_t mid_end = mid_begin + std::min(block_prod_block_depth, depth - mid_begin);
+      for (std::size_t
+          col_begin = 0;
+          col_begin < nbr_cols;
+          col_begin += block_prod_tile_cols)
+      {
+        const std::size_t tile_cols = std::min(block_prod_tile_cols, nbr_cols - col_begin);
+        const Scalar_T* rhs_cols = rhs + col_begin;
+        std::size_t row = 0;
+        if (tile_cols == 32 || tile_cols == 16 || tile_cols == 8)
+          for (;
+              row != tiled_rows;
+              row += block_prod_tile_rows)
+          {
+            const Scalar_T* lhs_rows = lhs + row * lhs_stride;
+            Scalar_T* result_tile = result + row * result_stride + col_begin;
+            switch (tile_cols)
+            {
+            case 32:
+              block_prod_tile<Scalar_T, 32>(mid_begin, mid_end, lhs_rows, lhs_stride,
+                                            rhs_cols, rhs_stride, result_tile, result_stride);
+              break;
+            case 16:
+              block_prod_tile<Scalar_T, 16>(mid_begin, mid_end, lhs_rows, lhs_stride,
+                                            rhs_cols, rhs_stride, result_tile, result_stride);
+              break;
+            default:
+              block_prod_tile<Scalar_T,  8>(mid_begin, mid_end, lhs_rows, lhs_stride,
+                                            rhs_cols, rhs_stride, result_tile, result_stride);
+              break;
+            }
+          }
+        // Rows of the result outside of the tiles
+        for (;
+            row != nbr_rows;
+            ++row)
+          block_prod_row(mid_begin, mid_end, tile_cols,
+                         lhs + row * lhs_stride,
+                         rhs_cols, rhs_stride,
+                         result + row * result_stride + col_begin);
+      }
+    }
+  }
+
+  /// Product of matrices, added to result, or assigned to result if init is true
+  // Dense matrices use the overload below. Other matrices use ublas::axpy_prod().
+  template< typename LHS_T, typename RHS_T, typename Result_T >
+  inline
+  void
+  block_prod(const LHS_T& lhs, const RHS_T& rhs, Result_T& result, const bool init)
+  { ublas::axpy_prod(lhs, rhs, result, init); }
+
+  /// Product of dense matrices, added to result, or assigned to result if init is true
+  // result must already have the size of the product, and must not share storage with lhs or rhs.
+  // A column major matrix is stored as the row major array of its transpose, so
+  // for column major matrices, trans(result) += trans(rhs) * trans(lhs) is computed instead.
+  template< typename Scalar_T, typename Orientation_T, typename Array_T >
+  void
+  block_prod(const ublas::matrix<Scalar_T,Orientation_T,Array_T>& lhs,
+             const ublas::matrix<Scalar_T,Orientation_T,Array_T>& rhs,
+                   ublas::matrix<Scalar_T,Orientation_T,Array_T>& result,
+             const bool init)
+  {
+    const std::size_t nbr_rows = lhs.size1();
+    const std::size_t depth    = lhs.size2();
+    const std::size_t nbr_cols = rhs.size2();
+    if (init)
+      result.clear();
+    if (nbr_rows == 0 || depth == 0 || nbr_cols == 0)
+      return;
+    const Scalar_T* lhs_data = &(lhs.data()[0]);
+    const Scalar_T* rhs_data = &(rhs.data()[0]);
+    Scalar_T* result_data = &(result.data()[0]);
+    if (boost::is_same<typename Orientation_T::orientation_category, ublas::row_major_tag>::value)
+      block_prod_rows(nbr_rows, depth, nbr_cols,
+                      lhs_data, depth,
+                      rhs_data, nbr_cols,
+                      result_data, nbr_cols);
+    else
+      block_prod_rows(nbr_cols, depth, nbr_rows,
+                      rhs_data, depth,
+                      lhs_data, nbr_rows,
+                      result_data, nbr_rows);
+  }
+
   /// Product of matrices
   template< typename LHS_T, typename RHS_T >
   inline
@@ -378,8 +588,9 @@ namespace glucat { namespace matrix
 #if defined(_GLUCAT_USE_DENSE_MATRICES)
     typedef typename RHS_T::size_type matrix_index_t;
     const matrix_index_t dim = lhs().size1();
+    const RHS_T lhs_matrix(lhs);
     RHS_T result(dim, dim);
-    ublas::axpy_prod(lhs, rhs, result, true);
+    block_prod(lhs_matrix, rhs(), result, true);
     return result;
 #else
     typedef typename RHS_T::expression_type expression_t;
@@ -455,7 +666,7 @@ namespace glucat { namespace matrix
     return result;
   }
 
-#if defined(_GLUCAT_USE_BINDINGS)
+#if defined(_GLUCAT_USE_BINDINGS) || defined(_GLUCAT_USE_LAPACK)
   /// Convert matrix to LAPACK format
   template< typename Matrix_T >
   static
@@ -485,47 +696,28 @@ namespace glucat { namespace matrix
           ++val_it2)
          result(val_it2.index1(), val_it2.index2()) = traits_t::to_double(*val_it2);
 
-      return result;
+    return result;
   }
 #endif
 
   /// Eigenvalues of a matrix
   template< typename Matrix_T >
+  inline
   ublas::vector< std::complex<double> >
   eigenvalues(const Matrix_T& val)
-  {
-    typedef std::complex<double> complex_t;
-    typedef typename ublas::vector<complex_t> complex_vector_t;
-    typedef typename Matrix_T::size_type matrix_index_t;
-
-    const matrix_index_t dim = val.size1();
-    complex_vector_t lambda = complex_vector_t(dim);
-    lambda.clear();
-
-#if defined(_GLUCAT_USE_BINDINGS)
-    namespace lapack = boost::numeric::bindings::lapack;
-    typedef typename ublas::matrix<double, ublas::column_major> lapack_matrix_t;
-
-    lapack_matrix_t T = to_lapack(val);
-    lapack_matrix_t V = T;
-    typedef typename ublas::vector<double> vector_t;
-    vector_t real_lambda = vector_t(dim);
-    vector_t imag_lambda = vector_t(dim);
-    fortran_int_t sdim = 0;
-
-    lapack::gees ('N', 'N', (external_fp)0, T, sdim, real_lambda, imag_lambda, V );
-
-    lambda.clear();
-    for (vector_t::size_type  k=0; k!= dim; ++k)
-      lambda[k] = complex_t(real_lambda[k], imag_lambda[k]);
-#endif
-    return lambda;
-  }
+  { return backend_t::eigenvalues(val); }
 
   /// Classify the eigenvalues of a matrix
   template< typename Matrix_T >
+  inline
   eig_genus<Matrix_T>
   classify_eigenvalues(const Matrix_T& val)
+  { return classify_eigenvalues<Matrix_T>(eigenvalues(val)); }
+
+  /// Classify the eigenvalues lambda of a matrix of type Matrix_T
+  template< typename Matrix_T >
+  eig_genus<Matrix_T>
+  classify_eigenvalues(const ublas::vector< std::complex<double> >& lambda)
   {
     typedef typename Matrix_T::value_type Scalar_T;
     eig_genus<Matrix_T> result;
@@ -534,7 +726,6 @@ namespace glucat { namespace matrix
 
     typedef std::complex<double> complex_t;
     typedef typename ublas::vector<complex_t> complex_vector_t;
-    complex_vector_t lambda = eigenvalues(val);
 
     std::set<double> arg_set;
 
@@ -608,6 +799,170 @@ namespace glucat { namespace matrix
     }
     return result;
   }
+
+  /// Unit matrix of dimension dim
+  inline
+  signed_perm::
+  signed_perm(const size_type dim)
+  : m_col(dim), m_neg(dim, false)
+  {
+    for (size_type
+        row = 0;
+        row != dim;
+        ++row)
+      this->m_col[row] = row;
+  }
+
+  /// Signed permutation matrix with the entries of mtx, a monomial matrix with entries +1 or -1
+  template< typename Matrix_T >
+  signed_perm::
+  signed_perm(const ublas::matrix_expression<Matrix_T>& mtx)
+  : m_col(mtx().size1()), m_neg(mtx().size1(), false)
+  {
+    typedef typename Matrix_T::const_iterator1 const_iterator1;
+    typedef typename Matrix_T::const_iterator2 const_iterator2;
+    typedef typename Matrix_T::value_type value_t;
+    for (const_iterator1
+        it1 = mtx().begin1();
+        it1 != mtx().end1();
+        ++it1)
+      for (const_iterator2
+          it2 = it1.begin();
+          it2 != it1.end();
+          ++it2)
+        if (*it2 != value_t(0))
+        {
+          this->m_col[it2.index1()] = size_type(it2.index2());
+          this->m_neg[it2.index1()] = (*it2 < value_t(0));
+        }
+  }
+
+  /// Signed permutation matrix from dim packed rows, each a column with the sign in its top bit
+  inline
+  signed_perm::
+  signed_perm(const size_type dim, const size_type* packed)
+  : m_col(dim), m_neg(dim)
+  {
+    for (size_type
+        row = 0;
+        row != dim;
+        ++row)
+    {
+      this->m_col[row] = packed[row] & ~packed_sign_bit;
+      this->m_neg[row] = (packed[row] & packed_sign_bit) != 0;
+    }
+  }
+
+  /// Dimension
+  inline
+  signed_perm::size_type
+  signed_perm::
+  size() const
+  { return size_type(this->m_col.size()); }
+
+  /// Column of the non-zero entry of row
+  inline
+  signed_perm::size_type
+  signed_perm::
+  col(const size_type row) const
+  { return this->m_col[row]; }
+
+  /// Is the non-zero entry of row negative?
+  inline
+  bool
+  signed_perm::
+  is_negative(const size_type row) const
+  { return this->m_neg[row]; }
+
+  /// Non-zero entry of row
+  inline
+  int
+  signed_perm::
+  sign(const size_type row) const
+  { return this->m_neg[row] ? -1 : 1; }
+
+  /// Estimated number of bytes used by the column indices and signs
+  inline
+  std::size_t
+  signed_perm::
+  bytes() const
+  { return this->m_col.size() * sizeof(size_type) + (this->m_neg.size() + 7) / 8; }
+
+  /// Write the dim packed rows, each a column with the sign in its top bit
+  inline
+  void
+  signed_perm::
+  pack(size_type* packed) const
+  {
+    const size_type dim = this->size();
+    for (size_type
+        row = 0;
+        row != dim;
+        ++row)
+      packed[row] = this->m_neg[row]
+                  ? (this->m_col[row] | packed_sign_bit)
+                  :  this->m_col[row];
+  }
+
+  /// Product of signed permutation matrices
+  inline
+  const
+  signed_perm
+  signed_perm_prod(const signed_perm& lhs, const signed_perm& rhs)
+  {
+    // Row i of lhs * rhs is lhs.sign(i) times row lhs.col(i) of rhs
+    typedef signed_perm::size_type size_type;
+    const size_type dim = lhs.size();
+    signed_perm result(dim);
+    for (size_type
+        row = 0;
+        row != dim;
+        ++row)
+    {
+      const size_type mid = lhs.m_col[row];
+      result.m_col[row] = rhs.m_col[mid];
+      result.m_neg[row] = (lhs.m_neg[row] != rhs.m_neg[mid]);
+    }
+    return result;
+  }
+
+  /// Add crd times a signed permutation matrix to a matrix
+  template< typename Matrix_T, typename Scalar_T >
+  void
+  signed_perm_plus_assign(Matrix_T& mtx, const signed_perm& perm, const Scalar_T& crd)
+  {
+    typedef signed_perm::size_type size_type;
+    const size_type dim = perm.size();
+    for (size_type
+        row = 0;
+        row != dim;
+        ++row)
+      if (perm.is_negative(row))
+        mtx(row, perm.col(row)) -= crd;
+      else
+        mtx(row, perm.col(row)) += crd;
+  }
+
+  /// Inner product of a signed permutation matrix and a matrix: sum(x(i,j)*y(i,j))/x.nrows()
+  template< typename Scalar_T, typename RHS_T >
+  Scalar_T
+  signed_perm_inner(const signed_perm& lhs, const RHS_T& rhs)
+  {
+    // Gather the one entry of rhs for each row of lhs
+    typedef signed_perm::size_type size_type;
+    Scalar_T result = Scalar_T(0);
+    const size_type dim = lhs.size();
+    for (size_type
+        row = 0;
+        row != dim;
+        ++row)
+    {
+      const Scalar_T& rhs_val = rhs(row, lhs.col(row));
+      if (rhs_val != Scalar_T(0))
+        result += lhs.is_negative(row) ? -rhs_val : rhs_val;
+    }
+    return result / Scalar_T(double(dim));
+  }
 } }
 
 #endif  // _GLUCAT_MATRIX_IMP_H
@@ -36,9 +36,11 @@
 #include "glucat/index_set.h"
 #include "glucat/clifford_algebra.h"
 #include "glucat/framed_multi.h"
+#include "glucat/cache.h"
 
 #include <boost/numeric/ublas/fwd.hpp>
 
+#include <cstddef>
 #include <fstream>
 #include <string>
 #include <utility>
@@ -56,6 +58,9 @@ namespace glucat
   template< typename Scalar_T, const index_t LO, const index_t HI >
   class matrix_multi;  // forward
 
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  class divisor;  // forward
+
   /// Geometric product
   template< typename Scalar_T, const index_t LO, const index_t HI >
   const matrix_multi<Scalar_T,LO,HI>
@@ -145,11 +150,14 @@ namespace glucat
     friend class framed_multi;
     template< typename Other_Scalar_T, const index_t Other_LO, const index_t Other_HI >
     friend class matrix_multi;
+    template< typename Other_Scalar_T, const index_t Other_LO, const index_t Other_HI >
+    friend class divisor;
 
   private:
     typedef ublas::row_major                           orientation_t;
     typedef ublas::compressed_matrix< int, orientation_t >
                                                        basis_matrix_t;
+    typedef matrix::signed_perm                        basis_perm_t;
 #if defined(_GLUCAT_USE_DENSE_MATRICES)
     typedef ublas::matrix< Scalar_T, orientation_t >   matrix_t;
 #else
@@ -184,6 +192,9 @@ namespace glucat
     matrix_multi(const Scalar_T& scr, const index_set_t frm = index_set_t());
     /// Construct a multivector from an int (within a frame, if given)
     matrix_multi(const int scr, const index_set_t frm = index_set_t());
+    /// Construct a multivector from the value of a lazy expression
+    template< typename Expr_T >
+    matrix_multi(const lazy_expr<Expr_T, multivector_t>& expr);
     /// Construct a multivector, within a given frame, from a given vector
     matrix_multi(const vector_t& vec,
                  const index_set_t frm, const bool prechecked = false);
@@ -219,7 +230,7 @@ namespace glucat
     /// Construct a multivector within a given frame from a given matrix
     matrix_multi(const matrix_t& mtx, const index_set_t frm);
     /// Create a basis element matrix within the current frame
-    const basis_matrix_t basis_element(const index_set<LO,HI>& ist) const;
+    const basis_perm_t basis_element(const index_set<LO,HI>& ist) const;
 
   public:
     _GLUCAT_CLIFFORD_ALGEBRA_OPERATIONS
@@ -230,6 +241,21 @@ namespace glucat
     /// Random multivector within a frame
     static const matrix_multi_t random(const index_set_t frm, Scalar_T fill = Scalar_T(1));
 
+    /// Counters of the use of the cache of basis elements
+    static const cache_stats basis_cache_stats();
+    /// Change the memory budget of the cache of basis elements
+    static void        set_basis_cache_max_bytes(const std::size_t max_bytes);
+    /// Counters of the use of the cache of generators
+    static const cache_stats generator_cache_stats();
+    /// Change the memory budget of the cache of generators
+    static void        set_generator_cache_max_bytes(const std::size_t max_bytes);
+#if defined(_GLUCAT_USE_BASIS_FILE)
+    /// Write a basis file of generators for p+q <= max_count and basis elements for p+q <= max_basis_count
+    static void        write_basis_file(const std::string& file_name,
+                                        const index_t max_count,
+                                        const index_t max_basis_count);
+#endif
+
     // Friend declarations
 
     friend const matrix_multi_t
@@ -269,6 +295,11 @@ namespace glucat
     multivector_t&     operator+= (const term_t& rhs);
 
    private:
+    /// Replace the value of this multivector by the value of val, leaving val unspecified
+    multivector_t&     take_value(multivector_t& val);
+    /// Part of this multivector within the subalgebra of its frame, dropping roundoff outside it
+    const multivector_t frame_part() const;
+
     // Data members
 
     /// Index set representing the frame for the subalgebra which contains the multivector
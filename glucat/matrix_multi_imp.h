@@ -34,6 +34,7 @@
 #include "glucat/matrix_multi.h"
 
 #include "glucat/matrix.h"
+#include "glucat/matrix_backend.h"
 #include "glucat/generation.h"
 
 # if  defined(_GLUCAT_GCC_IGNORE_UNUSED_LOCAL_TYPEDEFS)
@@ -209,6 +210,13 @@ namespace glucat
   matrix_multi(const int scr, const index_set_t frm)
   { *this = multivector_t(Scalar_T(scr), frm); }
 
+  /// Construct a multivector from the value of a lazy expression
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  template< typename Expr_T >
+  matrix_multi<Scalar_T,LO,HI>::
+  matrix_multi(const lazy_expr<Expr_T, multivector_t>& expr)
+  { lazy_eval(*this, expr); }
+
   /// Construct a multivector, within a given frame, from a given vector
   template< typename Scalar_T, const index_t LO, const index_t HI >
   matrix_multi<Scalar_T,LO,HI>::
@@ -346,6 +354,42 @@ namespace glucat
     return *this;
   }
 
+  /// Replace the value of this multivector by the value of val, leaving val unspecified
+  // The matrices are exchanged rather than copied.
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  inline
+  matrix_multi<Scalar_T,LO,HI>&
+  matrix_multi<Scalar_T,LO,HI>::
+  take_value(multivector_t& val)
+  {
+    this->m_frame = val.m_frame;
+    this->m_matrix.swap(val.m_matrix);
+    return *this;
+  }
+
+  /// Part of this multivector within the subalgebra of its frame, dropping roundoff outside it
+  // The orthogonal transforms of a real Schur decomposition leave roundoff in the matrix
+  // outside the image of the subalgebra. For matrices of dimension inv_fast_dim_threshold
+  // or more, framed_multi_t(*this) uses fast_framed_multi(), which gives the coordinates
+  // of the matrix in the enclosing real superalgebra, so that this roundoff becomes terms
+  // whose index sets are not within the frame. Such terms would otherwise expand the frame
+  // of each later sum with a multivector in a different frame, via reframe().
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  const matrix_multi<Scalar_T,LO,HI>
+  matrix_multi<Scalar_T,LO,HI>::
+  frame_part() const
+  {
+    const framed_multi_t framed_val = framed_multi_t(*this);
+    framed_multi_t result;
+    for (typename framed_multi_t::const_iterator
+        val_it = framed_val.begin();
+        val_it != framed_val.end();
+        ++val_it)
+      if ((val_it->first | this->m_frame) == this->m_frame)
+        result += *val_it;
+    return multivector_t(result, this->m_frame, true);
+  }
+
   /// Find a common frame for operands of a binary operator
   template< typename Scalar_T, const index_t LO, const index_t HI >
   inline
@@ -517,6 +561,49 @@ namespace glucat
     return *this;
   }
 
+  /// Geometric sum of multivector and product of multivector and scalar
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  matrix_multi<Scalar_T,LO,HI>&
+  matrix_multi<Scalar_T,LO,HI>::
+  add_scaled(const multivector_t& rhs, const Scalar_T& crd)
+  {
+    typedef numeric_traits<Scalar_T> traits_t;
+
+    // Fuse the product and sum only within the same frame
+    if (&rhs == this || crd == Scalar_T(0) || traits_t::isNaN_or_isInf(crd)
+        || rhs.m_frame != this->m_frame)
+      return *this += rhs * crd;
+    noalias(this->m_matrix) += crd * rhs.m_matrix;
+    return *this;
+  }
+
+  /// Assign the value of a lazy expression
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  template< typename Expr_T >
+  inline
+  matrix_multi<Scalar_T,LO,HI>&
+  matrix_multi<Scalar_T,LO,HI>::
+  operator= (const lazy_expr<Expr_T, multivector_t>& rhs)
+  { return lazy_assign(*this, rhs); }
+
+  /// Geometric sum of multivector and lazy expression
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  template< typename Expr_T >
+  inline
+  matrix_multi<Scalar_T,LO,HI>&
+  matrix_multi<Scalar_T,LO,HI>::
+  operator+= (const lazy_expr<Expr_T, multivector_t>& rhs)
+  { return lazy_add(*this, rhs, Scalar_T(1)); }
+
+  /// Geometric difference of multivector and lazy expression
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  template< typename Expr_T >
+  inline
+  matrix_multi<Scalar_T,LO,HI>&
+  matrix_multi<Scalar_T,LO,HI>::
+  operator-= (const lazy_expr<Expr_T, multivector_t>& rhs)
+  { return lazy_add(*this, rhs, Scalar_T(-1)); }
+
   /// Unary -
   template< typename Scalar_T, const index_t LO, const index_t HI >
   inline
@@ -572,10 +659,20 @@ namespace glucat
 #if defined(_GLUCAT_USE_DENSE_MATRICES)
     typedef typename matrix_t::size_type matrix_index_t;
 
+    // Multiply directly into the result matrix: prod() initializes it
     const matrix_index_t dim = lhs_ref.m_matrix.size1();
-    multivector_t result = multivector_t(matrix_t(dim, dim), our_frame);
-    result.m_matrix.clear();
-    ublas::axpy_prod(lhs_ref.m_matrix, rhs_ref.m_matrix, result.m_matrix, true);
+    multivector_t result;
+    result.m_frame = our_frame;
+    result.m_matrix.resize(dim, dim, false);
+    // If p-q == 3 (mod 4), the pseudoscalar of the frame is central and has square -1,
+    // so the algebra is isomorphic to a complex matrix algebra of half the dimension.
+    // Reference: [P] Table 15.27, p 133
+    if (dim >= matrix_index_t(Tune_P::complex_mult_dim_threshold)
+     && pos_mod(our_frame.count_pos() - our_frame.count_neg(), 4) == 3)
+      matrix::complex_prod(lhs_ref.m_matrix, rhs_ref.m_matrix,
+                           result.basis_element(our_frame), result.m_matrix);
+    else
+      matrix::backend_t::prod(lhs_ref.m_matrix, rhs_ref.m_matrix, result.m_matrix, true);
     return result;
 #else
     typedef typename matrix_t::expression_type expression_t;
@@ -591,7 +688,10 @@ namespace glucat
   matrix_multi<Scalar_T,LO,HI>&
   matrix_multi<Scalar_T,LO,HI>::
   operator*= (const multivector_t& rhs)
-  { return *this = *this * rhs; }
+  {
+    multivector_t result = *this * rhs;
+    return this->take_value(result);
+  }
 
   /// Outer product
   template< typename Scalar_T, const index_t LO, const index_t HI >
@@ -610,7 +710,10 @@ namespace glucat
   matrix_multi<Scalar_T,LO,HI>&
   matrix_multi<Scalar_T,LO,HI>::
   operator^= (const multivector_t& rhs)
-  { return *this = *this ^ rhs; }
+  {
+    multivector_t result = *this ^ rhs;
+    return this->take_value(result);
+  }
 
   /// Inner product
   template< typename Scalar_T, const index_t LO, const index_t HI >
@@ -629,7 +732,10 @@ namespace glucat
   matrix_multi<Scalar_T,LO,HI>&
   matrix_multi<Scalar_T,LO,HI>::
   operator&= (const multivector_t& rhs)
-  { return *this = *this & rhs; }
+  {
+    multivector_t result = *this & rhs;
+    return this->take_value(result);
+  }
 
   /// Left contraction
   template< typename Scalar_T, const index_t LO, const index_t HI >
@@ -648,7 +754,10 @@ namespace glucat
   matrix_multi<Scalar_T,LO,HI>&
   matrix_multi<Scalar_T,LO,HI>::
   operator%= (const multivector_t& rhs)
-  { return *this = *this % rhs; }
+  {
+    multivector_t result = *this % rhs;
+    return this->take_value(result);
+  }
 
   /// Hestenes scalar product
   template< typename Scalar_T, const index_t LO, const index_t HI >
@@ -695,74 +804,8 @@ namespace glucat
       : rhs_reframed;
 
     // Solve result == lhs_ref/rhs_ref <=> result*rhs_ref == lhs_ref
-    // We now solve X == B/A
-    // (where X == result, B == lhs_ref.m_matrix and A == rhs_ref.m_matrix)
-    // X == B/A <=> X*A == B <=> AT*XT == BT
-    // So, we solve AT*XT == BT
-
-    typedef typename multivector_t::matrix_t matrix_t;
-    typedef typename matrix_t::size_type matrix_index_t;
-
-    const matrix_t& AT = ublas::trans(rhs_ref.m_matrix);
-    matrix_t LU = AT;
-
-    typedef ublas::permutation_matrix<matrix_index_t> permutation_t;
-
-    permutation_t pvector(AT.size1());
-    if (! ublas::lu_factorize(LU, pvector))
-    {
-      const matrix_t& BT = ublas::trans(lhs_ref.m_matrix);
-      matrix_t XT = BT;
-      ublas::lu_substitute(LU, pvector, XT);
-#if defined(_GLUCAT_CHECK_ISNAN)
-      if (matrix::isnan(XT))
-        return traits_t::NaN();
-#endif
-
-      // Iterative refinement.
-      // Reference: Nicholas J. Higham, "Accuracy and Stability of Numerical Algorithms",
-      // SIAM, 1996, ISBN 0-89871-355-2, Chapter 11
-      if (Tune_P::div_max_steps > 0)
-      {
-        // matrix_t R = ublas::prod(AT, XT) - BT;
-        matrix_t R = -BT;
-        ublas::axpy_prod(AT, XT, R, false);
-#if defined(_GLUCAT_CHECK_ISNAN)
-        if (matrix::isnan(R))
-          return traits_t::NaN();
-#endif
-
-        Scalar_T nr = ublas::norm_inf(R);
-        if ( nr != Scalar_T(0) && !traits_t::isNaN_or_isInf(nr) )
-        {
-          matrix_t XTnew = XT;
-          Scalar_T nrold = nr + Scalar_T(1);
-          for (int
-              step = 0;
-              step != Tune_P::div_max_steps &&
-              nr < nrold &&
-              nr != Scalar_T(0) &&
-              nr == nr;
-              ++step)
-          {
-            nrold = nr;
-            if (step != 0)
-              XT = XTnew;
-            matrix_t& D = R;
-            ublas::lu_substitute(LU, pvector, D);
-            XTnew -= D;
-            // noalias(R) = ublas::prod(AT, XTnew) - BT;
-            R = -BT;
-            ublas::axpy_prod(AT, XTnew, R, false);
-            nr = ublas::norm_inf(R);
-          }
-        }
-      }
-      return multivector_t(ublas::trans(XT), our_frame);
-    }
-    else
-      // AT is singular. Return NaN
-      return traits_t::NaN();
+    // The LU factorization, substitution and refinement are done by divisor<>
+    return divisor<Scalar_T,LO,HI>(rhs_ref).quotient(lhs_ref);
   }
 
   /// Geometric quotient
@@ -771,7 +814,10 @@ namespace glucat
   matrix_multi<Scalar_T,LO,HI>&
   matrix_multi<Scalar_T,LO,HI>::
   operator/= (const multivector_t& rhs)
-  { return *this = *this / rhs; }
+  {
+    multivector_t result = *this / rhs;
+    return this->take_value(result);
+  }
 
   /// Transformation via twisted adjoint action
   template< typename Scalar_T, const index_t LO, const index_t HI >
@@ -786,7 +832,10 @@ namespace glucat
   matrix_multi<Scalar_T,LO,HI>&
   matrix_multi<Scalar_T,LO,HI>::
   operator|= (const multivector_t& rhs)
-  { return *this = rhs * *this / rhs.involute(); }
+  {
+    multivector_t result = rhs * *this / rhs.involute();
+    return this->take_value(result);
+  }
 
   /// Clifford multiplicative inverse
   template< typename Scalar_T, const index_t LO, const index_t HI >
@@ -850,7 +899,7 @@ namespace glucat
   {
     // Use matrix inner product only if ist is in frame
     if ( (ist | this->m_frame) == this->m_frame)
-      return matrix::inner<Scalar_T>(this->basis_element(ist), this->m_matrix);
+      return matrix::signed_perm_inner<Scalar_T>(this->basis_element(ist), this->m_matrix);
     else
       return Scalar_T(0);
   }
@@ -933,7 +982,7 @@ namespace glucat
         // Frame may contain indices which do not correspond to a grade 1 term but
         // frame cannot omit any index corresponding to a grade 1 term
         result.push_back(
-          matrix::inner<Scalar_T>(this->basis_element(index_set_t(idx)),
+          matrix::signed_perm_inner<Scalar_T>(this->basis_element(index_set_t(idx)),
           this->m_matrix));
     return result;
   }
@@ -1075,7 +1124,7 @@ namespace glucat
   operator+= (const term_t& term)
   {
     if (term.second != Scalar_T(0))
-      this->m_matrix.plus_assign(matrix_t(this->basis_element(term.first)) * term.second);
+      matrix::signed_perm_plus_assign(this->m_matrix, this->basis_element(term.first), term.second);
     return *this;
   }
 
@@ -1217,15 +1266,83 @@ namespace glucat
   }
 
   /// Table of basis elements used as a cache by basis_element()
+  // The table is split into shards, each with its own lock and its own share of the
+  // memory budget, so that threads using different basis elements rarely wait for each other.
+  // Each shard evicts its least recently used basis elements to keep within its budget.
   template< typename Scalar_T, const index_t LO, const index_t HI, typename Matrix_T >
-  class basis_table :
-  public std::map< std::pair< const index_set<LO,HI>, const index_set<LO,HI> >,
-                   Matrix_T* >
+  class basis_table
   {
   public:
+    typedef index_set<LO,HI>                                 index_set_t;
+    typedef std::pair<index_set_t, index_set_t>              index_set_pair_t;
+
     /// Single instance of basis table
     static basis_table& basis() { static basis_table b; return b;}
+
+    /// Copy the basis element for key into result, if found
+    bool find(const index_set_pair_t& key, Matrix_T& result)
+    {
+      shard_t& shard = this->shard_of(key);
+      cache_lock_t lock(shard.m_mutex);
+      const Matrix_T* basis_ptr = shard.m_cache.find(key);
+      if (basis_ptr == 0)
+        return false;
+      result = *basis_ptr;
+      return true;
+    }
+    /// Save the basis element for key
+    void insert(const index_set_pair_t& key, const Matrix_T& val)
+    {
+      shard_t& shard = this->shard_of(key);
+      cache_lock_t lock(shard.m_mutex);
+      shard.m_cache.insert(key, val, sizeof(key) + sizeof(val) + val.bytes());
+      shard.m_cache.evict();
+    }
+    /// Counters of the use of the table
+    const cache_stats stats()
+    {
+      cache_stats result;
+      for (std::size_t
+          k = 0;
+          k != nbr_shards;
+          ++k)
+      {
+        cache_lock_t lock(this->m_shards[k].m_mutex);
+        result += this->m_shards[k].m_cache.stats();
+      }
+      return result;
+    }
+    /// Change the memory budget of the table, evicting basis elements if needed
+    void set_max_bytes(const std::size_t max_bytes)
+    {
+      for (std::size_t
+          k = 0;
+          k != nbr_shards;
+          ++k)
+      {
+        cache_lock_t lock(this->m_shards[k].m_mutex);
+        this->m_shards[k].m_cache.set_max_bytes(max_bytes / nbr_shards);
+      }
+    }
   private:
+    /// Number of shards
+    static const std::size_t nbr_shards = 16;
+
+    struct shard_t
+    {
+      shard_t()
+      : m_cache(DEFAULT_Basis_Cache_Max_Bytes / nbr_shards)
+      { }
+      /// Cache of basis elements
+      lru_cache<index_set_pair_t, Matrix_T> m_cache;
+      /// Guards the cache
+      cache_mutex_t                         m_mutex;
+    };
+
+    /// Shard which holds the basis element for key
+    shard_t& shard_of(const index_set_pair_t& key)
+    { return this->m_shards[(key.first.hash_fn() ^ (key.second.hash_fn() * 31)) % nbr_shards]; }
+
     // Enforce singleton
     // Reference: A. Alexandrescu, "Modern C++ Design", Chapter 6
     basis_table() {}
@@ -1233,6 +1350,9 @@ namespace glucat
     basis_table(const basis_table&);
     basis_table& operator= (const basis_table&);
 
+    /// Shards of the table
+    shard_t m_shards[nbr_shards];
+
     /// Friend declaration to avoid compiler warning:
     /// "... only defines a private destructor and has no friends"
     /// Ref: Carlos O'Ryan, ACE http://doc.ece.uci.edu
@@ -1241,62 +1361,97 @@ namespace glucat
 
   /// Create a basis element matrix within the current frame
   template< typename Scalar_T, const index_t LO, const index_t HI >
-  const typename matrix_multi<Scalar_T,LO,HI>::basis_matrix_t
+  const typename matrix_multi<Scalar_T,LO,HI>::basis_perm_t
   matrix_multi<Scalar_T,LO,HI>::
   basis_element(const index_set_t& ist) const
   {
-    typedef std::pair<const index_set_t, const index_set_t>     index_set_pair_t;
-    const index_set_pair_t& unfolded_pair = index_set_pair_t(ist, this->m_frame);
-
-    typedef basis_table<Scalar_T,LO,HI,basis_matrix_t>          basis_table_t;
-    typedef typename basis_table_t::const_iterator              basis_const_iterator_t;
+    typedef basis_table<Scalar_T,LO,HI,basis_perm_t>            basis_table_t;
+    typedef typename basis_table_t::index_set_pair_t            index_set_pair_t;
+    const index_set_pair_t unfolded_pair(ist, this->m_frame);
     basis_table_t& basis_cache = basis_table_t::basis();
 
+    // The pseudoscalar of the frame is always cached, because operator* uses it
+    // as the imaginary unit of the complex representation, for any frame.
     const index_t frame_count = this->m_frame.count();
-    const bool use_cache = frame_count <= index_t(Tune_P::basis_max_count);
+    const bool use_cache = frame_count <= index_t(Tune_P::basis_max_count)
+                        || ist == this->m_frame;
 
-    if (use_cache)
-    {
-      const basis_const_iterator_t basis_it = basis_cache.find(unfolded_pair);
-      if (basis_it != basis_cache.end())
-        return *(basis_it->second);
-    }
+    basis_perm_t result;
+    if (use_cache && basis_cache.find(unfolded_pair, result))
+      return result;
     const index_set_t folded_set = ist.fold(this->m_frame);
     const index_set_t folded_frame = this->m_frame.fold();
-    const index_set_pair_t& folded_pair = index_set_pair_t(folded_set, folded_frame);
-    typedef std::pair<const index_set_pair_t, basis_matrix_t*>  basis_pair_t;
-    if (use_cache)
+    const index_set_pair_t folded_pair(folded_set, folded_frame);
+    if (use_cache && basis_cache.find(folded_pair, result))
     {
-      const basis_const_iterator_t basis_it = basis_cache.find(folded_pair);
-      if (basis_it != basis_cache.end())
-      {
-        basis_matrix_t* result_ptr = basis_it->second;
-        basis_cache.insert(basis_pair_t(unfolded_pair, result_ptr));
-        return *result_ptr;
-      }
+      basis_cache.insert(unfolded_pair, result);
+      return result;
     }
     const index_t folded_max = folded_frame.max();
     const index_t folded_min = folded_frame.min();
     const index_t p = std::max(folded_max,           index_t(0));
     const index_t q = std::max(index_t(-folded_min), index_t(0));
-    const basis_matrix_t* e = (gen::generator_table<basis_matrix_t>::generator())(p, q);
-    const matrix_index_t dim = 1 << offset_level(p, q);
-    basis_matrix_t result = matrix::unit<basis_matrix_t>(dim);
-    for (index_t
-        k = folded_min;
-        k <= folded_max;
-        ++k)
-      if (folded_set[k])
-        result = matrix::mono_prod(result, e[k]);
+#if defined(_GLUCAT_USE_BASIS_FILE)
+    if (!basis_file::file().basis_element(p, q, folded_set.value_of_fold(folded_frame), result))
+#endif
+    {
+      const std::vector<basis_matrix_t>& e = (gen::generator_table<basis_matrix_t>::generator())(p, q);
+      const matrix_index_t dim = 1 << offset_level(p, q);
+      result = basis_perm_t(dim);
+      for (index_t
+          k = folded_min;
+          k <= folded_max;
+          ++k)
+        if (folded_set[k])
+          result = matrix::signed_perm_prod(result, basis_perm_t(e[q + k]));
+    }
     if (use_cache)
     {
-      basis_matrix_t* result_ptr = new basis_matrix_t(result);
-      basis_cache.insert(basis_pair_t(folded_pair, result_ptr));
-      basis_cache.insert(basis_pair_t(unfolded_pair, result_ptr));
+      basis_cache.insert(folded_pair, result);
+      basis_cache.insert(unfolded_pair, result);
     }
     return result;
   }
 
+  /// Counters of the use of the cache of basis elements
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  const cache_stats
+  matrix_multi<Scalar_T,LO,HI>::
+  basis_cache_stats()
+  { return basis_table<Scalar_T,LO,HI,basis_perm_t>::basis().stats(); }
+
+  /// Change the memory budget of the cache of basis elements
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  void
+  matrix_multi<Scalar_T,LO,HI>::
+  set_basis_cache_max_bytes(const std::size_t max_bytes)
+  { basis_table<Scalar_T,LO,HI,basis_perm_t>::basis().set_max_bytes(max_bytes); }
+
+  /// Counters of the use of the cache of generators
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  const cache_stats
+  matrix_multi<Scalar_T,LO,HI>::
+  generator_cache_stats()
+  { return gen::generator_table<basis_matrix_t>::generator().stats(); }
+
+  /// Change the memory budget of the cache of generators
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  void
+  matrix_multi<Scalar_T,LO,HI>::
+  set_generator_cache_max_bytes(const std::size_t max_bytes)
+  { gen::generator_table<basis_matrix_t>::generator().set_max_bytes(max_bytes); }
+
+#if defined(_GLUCAT_USE_BASIS_FILE)
+  /// Write a basis file of generators for p+q <= max_count and basis elements for p+q <= max_basis_count
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  void
+  matrix_multi<Scalar_T,LO,HI>::
+  write_basis_file(const std::string& file_name,
+                   const index_t max_count,
+                   const index_t max_basis_count)
+  { basis_file::write<basis_matrix_t>(file_name, max_count, max_basis_count); }
+#endif
+
   /// Pade' approximation
   template< typename Scalar_T, const index_t LO, const index_t HI >
   inline
@@ -1314,46 +1469,13 @@ namespace glucat
     if (X.isnan())
       return traits_t::NaN();
 
-    // Array size is assumed to be even
-    const int nbr_even_powers = array_size/2 - 1;
-
-    // Create an array of even powers
-    std::vector<multivector_t> XX(nbr_even_powers);
-    XX[0] = X * X;
-    XX[1] = XX[0] * XX[0];
-    for (int
-      k = 2;
-      k != nbr_even_powers;
-      ++k)
-      XX[k] = XX[k-2] * XX[1];
-
-    // Calculate numerator N and denominator D
-    multivector_t N = a[1];
-    for (int
-        k = 0;
-        k != nbr_even_powers;
-        ++k)
-      N += XX[k] * a[2*k + 3];
-    N *= X;
-    N += a[0];
-    for (int
-        k = 0;
-        k != nbr_even_powers;
-        ++k)
-      N += XX[k] * a[2*k + 2];
-    multivector_t D = b[1];
-    for (int
-        k = 0;
-        k != nbr_even_powers;
-        ++k)
-      D += XX[k] * b[2*k + 3];
-    D *= X;
-    D += b[0];
-    for (int
-        k = 0;
-        k != nbr_even_powers;
-        ++k)
-      D += XX[k] * b[2*k + 2];
+    // N and D are polynomials in X of degree array_size - 1,
+    // evaluated by the Paterson-Stockmeyer method, sharing the powers of X
+    const int degree = array_size - 1;
+    std::vector<multivector_t> powers;
+    paterson_stockmeyer_powers(X, degree, 2, powers);
+    const multivector_t& N = paterson_stockmeyer(a, degree, powers);
+    const multivector_t& D = paterson_stockmeyer(b, degree, powers);
     return N / D;
   }
 
@@ -1695,9 +1817,52 @@ namespace glucat
     const multivector_t& unitval = val / scale;
     const Scalar_T max_norm = Scalar_T(1.0/4.0);
 
+    typedef typename multivector_t::matrix_t matrix_t;
+    // The real Schur decomposition needs no external library, so unlike classify_eigenvalues(),
+    // it does not depend on _GLUCAT_USE_EIGENVALUES. It is used for matrices of dimension
+    // schur_dim_threshold or more: setting Schur_Dim_Threshold above the largest dimension
+    // restores the behaviour of the code below.
+    if (unitval.m_matrix.size1() >= Tune_P::schur_dim_threshold)
+    {
+      // One real Schur decomposition both classifies the eigenvalues and gives the square root
+      const matrix::real_schur<matrix_t> schur(unitval.m_matrix);
+      if (schur.is_valid())
+      {
+        multivector_t scaled_result;
+        const matrix::eig_genus<matrix_t> genus = schur.classify();
+        switch (genus.m_eig_case)
+        {
+        case matrix::negative_eig_case:
+          scaled_result = matrix_sqrt(-i * unitval, i) * (i + Scalar_T(1)) / sqrt_2;
+          break;
+        case matrix::both_eig_case:
+          {
+            // Since i*i == -1, exp(i*x) == cos(x) + i*sin(x)
+            const Scalar_T safe_arg = genus.m_safe_arg;
+            const Scalar_T half_arg = safe_arg/Scalar_T(2);
+            scaled_result = matrix_sqrt((traits_t::cos(safe_arg) + i * traits_t::sin(safe_arg)) * unitval, i) *
+                            (traits_t::cos(half_arg) - i * traits_t::sin(half_arg));
+          }
+          break;
+        default:
+          {
+            matrix_t sqrt_matrix;
+            if (schur.sqrt(sqrt_matrix))
+              scaled_result = multivector_t(sqrt_matrix, unitval.m_frame).frame_part();
+            else
+              scaled_result = traits_t::NaN();
+          }
+          break;
+        }
+        if (scaled_result.isnan())
+          return traits_t::NaN();
+        else
+          return scaled_result * rescale;
+      }
+    }
+
 #if defined(_GLUCAT_USE_EIGENVALUES)
     multivector_t scaled_result;
-    typedef typename multivector_t::matrix_t matrix_t;
 
     // What kind of eigenvalues does the matrix contain?
     matrix::eig_genus<matrix_t> genus = matrix::classify_eigenvalues(unitval.m_matrix);
@@ -2107,9 +2272,54 @@ namespace glucat{
     const multivector_t unitval = val/scale;
     if (inv(unitval).isnan())
       return traits_t::NaN();
+
+    typedef typename multivector_t::matrix_t matrix_t;
+    // As for sqrt(), the real Schur decomposition does not depend on _GLUCAT_USE_EIGENVALUES
+    if (unitval.m_matrix.size1() >= Tune_P::schur_dim_threshold)
+    {
+      // One real Schur decomposition both classifies the eigenvalues and gives the
+      // repeated square roots of inverse scaling and squaring.
+      // Reference: [HFM], Algorithm 11.9
+      const matrix::real_schur<matrix_t> schur(unitval.m_matrix);
+      if (schur.is_valid())
+      {
+        multivector_t scaled_result;
+        const matrix::eig_genus<matrix_t> genus = schur.classify();
+        switch (genus.m_eig_case)
+        {
+        case matrix::negative_eig_case:
+          scaled_result = matrix_log(-i * unitval, i) + i * pi/Scalar_T(2);
+          break;
+        case matrix::both_eig_case:
+          {
+            // Since i*i == -1, exp(i*x) == cos(x) + i*sin(x)
+            const Scalar_T safe_arg = genus.m_safe_arg;
+            scaled_result = matrix_log((traits_t::cos(safe_arg) + i * traits_t::sin(safe_arg)) * unitval, i) -
+                            i * safe_arg;
+          }
+          break;
+        default:
+          {
+            typedef std::numeric_limits<Scalar_T> limits_t;
+            static const Scalar_T max_outer_norm = Scalar_T(6.0/limits_t::digits);
+            matrix_t root_matrix;
+            int nbr_steps;
+            if (schur.repeated_sqrt(max_outer_norm, Tune_P::log_max_outer_steps, root_matrix, nbr_steps))
+              scaled_result = pade_log(multivector_t(root_matrix, unitval.m_frame).frame_part()) *
+                              traits_t::pow(Scalar_T(2), nbr_steps);
+            else
+              scaled_result = traits_t::NaN();
+          }
+          break;
+        }
+        if (scaled_result.isnan())
+          return traits_t::NaN();
+        else
+          return scaled_result + rescale;
+      }
+    }
 #if defined(_GLUCAT_USE_EIGENVALUES)
     multivector_t scaled_result;
-    typedef typename multivector_t::matrix_t matrix_t;
 
     // What kind of eigenvalues does the matrix contain?
     matrix::eig_genus<matrix_t> genus = matrix::classify_eigenvalues(unitval.m_matrix);
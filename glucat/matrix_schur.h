@@ -0,0 +1,101 @@
+#ifndef _GLUCAT_MATRIX_SCHUR_H
+#define _GLUCAT_MATRIX_SCHUR_H
+/***************************************************************************
+    GluCat : Generic library of universal Clifford algebra templates
+    matrix_schur.h : Declare the real Schur decomposition of a matrix
+                             -------------------
+    begin                : Sat 2026-10-17
+    copyright            : (C) 2001-2016 by Paul C. Leopardi
+ ***************************************************************************
+
+    This library is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published
+    by the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with this library.  If not, see <http://www.gnu.org/licenses/>.
+
+ ***************************************************************************
+ This library is based on a prototype written by Arvind Raja and was
+ licensed under the LGPL with permission of the author. See Arvind Raja,
+ "Object-oriented implementations of Clifford algebras in C++: a prototype",
+ in Ablamowicz, Lounesto and Parra (eds.)
+ "Clifford algebras with numeric and symbolic computations, Birkhauser, 1996."
+ ***************************************************************************
+ See also Arvind Raja's original header comments and references in glucat.h
+ ***************************************************************************/
+
+
+#include "glucat/matrix.h"
+
+#include <boost/numeric/ublas/fwd.hpp>
+
+#include <complex>
+#include <vector>
+
+namespace glucat
+{
+  namespace matrix
+  {
+    /// Real Schur decomposition of a matrix, and functions of the matrix evaluated from it
+    // val == Q * T * trans(Q), where Q is orthogonal and T is quasi upper triangular.
+    // One decomposition gives both the eigenvalues of val, from the diagonal blocks of T,
+    // and the square roots of val, from triangular recurrences on T, so that the
+    // eigenvalue classification, sqrt and log of a matrix_multi share the same O(dim^3) work.
+    // Reference: [HFM], Sections 6.2 and 11.5
+    template< typename Matrix_T >
+    class real_schur
+    {
+    public:
+      typedef typename Matrix_T::value_type                   Scalar_T;
+      typedef ublas::matrix<Scalar_T, ublas::row_major>       dense_t;
+      typedef typename dense_t::size_type                     matrix_index_t;
+
+      /// Decompose val, using backend_t::real_schur
+      explicit real_schur(const Matrix_T& val);
+
+      /// Did the decomposition succeed?
+      bool                                  is_valid() const;
+      /// Eigenvalues of val
+      ublas::vector< std::complex<double> > eigenvalues() const;
+      /// Classification of the eigenvalues of val
+      eig_genus<Matrix_T>                   classify() const;
+      /// Principal square root of val
+      // Returns false if val has a negative real or zero eigenvalue.
+      bool                                  sqrt(Matrix_T& result) const;
+      /// Repeated principal square root of val, until the root is near the unit matrix
+      // Finds the least nbr_steps <= max_steps such that
+      // result == val^(1/2^nbr_steps) has norm_frob2(result - 1)/dim <= max_norm.
+      // Returns false if there is no such nbr_steps or if a square root fails.
+      bool                                  repeated_sqrt(const Scalar_T max_norm, const int max_steps,
+                                                          Matrix_T& result, int& nbr_steps) const;
+    private:
+      /// Principal square root of a quasi upper triangular matrix with the given diagonal blocks
+      static bool                           quasi_triangular_sqrt(const dense_t& t,
+                                                                  const std::vector<matrix_index_t>& block_start,
+                                                                  dense_t& result);
+      /// Solve lhs * x + x * rhs == c for x, where lhs and rhs are 1x1 or 2x2
+      static bool                           small_sylvester(const Scalar_T* lhs, const matrix_index_t lhs_dim,
+                                                            const Scalar_T* rhs, const matrix_index_t rhs_dim,
+                                                            Scalar_T* c);
+      /// Q * val * trans(Q)
+      void                                  back_transform(const dense_t& val, Matrix_T& result) const;
+
+      /// Orthogonal factor Q
+      dense_t                               m_q;
+      /// Quasi upper triangular factor T
+      dense_t                               m_t;
+      /// Start of each diagonal block of T, followed by the dimension of T
+      std::vector<matrix_index_t>           m_block_start;
+      /// Did the decomposition succeed?
+      bool                                  m_valid;
+    };
+  }
+}
+#endif  // _GLUCAT_MATRIX_SCHUR_H
@@ -0,0 +1,409 @@
+#ifndef _GLUCAT_MATRIX_SCHUR_IMP_H
+#define _GLUCAT_MATRIX_SCHUR_IMP_H
+/***************************************************************************
+    GluCat : Generic library of universal Clifford algebra templates
+    matrix_schur_imp.h : Implement the real Schur decomposition of a matrix
+                             -------------------
+    begin                : Sat 2026-10-17
+    copyright            : (C) 2001-2016 by Paul C. Leopardi
+ ***************************************************************************
+
+    This library is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published
+    by the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with this library.  If not, see <http://www.gnu.org/licenses/>.
+
+ ***************************************************************************
+ This library is based on a prototype written by Arvind Raja and was
+ licensed under the LGPL with permission of the author. See Arvind Raja,
+ "Object-oriented implementations of Clifford algebras in C++: a prototype",
+ in Ablamowicz, Lounesto and Parra (eds.)
+ "Clifford algebras with numeric and symbolic computations, Birkhauser, 1996."
+ ***************************************************************************
+ See also Arvind Raja's original header comments and references in glucat.h
+ ***************************************************************************/
+
+
+#include "glucat/matrix_schur.h"
+#include "glucat/matrix_backend.h"
+#include "glucat/scalar.h"
+
+#include <cstddef>
+
+namespace glucat { namespace matrix
+{
+  /// Decompose val, using backend_t::real_schur
+  template< typename Matrix_T >
+  real_schur<Matrix_T>::
+  real_schur(const Matrix_T& val)
+  : m_t(val),
+    m_valid(false)
+  {
+    this->m_valid = backend_t::real_schur(this->m_t, this->m_q);
+    if (!this->m_valid)
+      return;
+
+    // Find the diagonal blocks of T
+    const matrix_index_t dim = this->m_t.size1();
+    for (matrix_index_t
+        k = 0;
+        k < dim;
+        k += (k + 1 < dim && this->m_t(k + 1, k) != Scalar_T(0)) ? 2 : 1)
+      this->m_block_start.push_back(k);
+    this->m_block_start.push_back(dim);
+  }
+
+  /// Did the decomposition succeed?
+  template< typename Matrix_T >
+  inline
+  bool
+  real_schur<Matrix_T>::
+  is_valid() const
+  { return this->m_valid; }
+
+  /// Eigenvalues of val
+  template< typename Matrix_T >
+  ublas::vector< std::complex<double> >
+  real_schur<Matrix_T>::
+  eigenvalues() const
+  {
+    typedef numeric_traits<Scalar_T> traits_t;
+    typedef std::complex<double> complex_t;
+
+    const matrix_index_t dim = this->m_t.size1();
+    ublas::vector<complex_t> lambda(dim);
+    lambda.clear();
+    if (!this->m_valid)
+      return lambda;
+
+    const dense_t& t = this->m_t;
+    for (std::size_t
+        block = 0;
+        block + 1 < this->m_block_start.size();
+        ++block)
+    {
+      const matrix_index_t k = this->m_block_start[block];
+      if (this->m_block_start[block + 1] == k + 1)
+        lambda[k] = complex_t(traits_t::to_double(t(k, k)), 0.0);
+      else
+      {
+        // The eigenvalues of the block [a b; c d] are theta +/- sqrt(half_diff^2 + b*c)
+        const double theta = traits_t::to_double((t(k, k) + t(k+1, k+1)) / Scalar_T(2));
+        const Scalar_T half_diff = (t(k, k) - t(k+1, k+1)) / Scalar_T(2);
+        const double disc = traits_t::to_double(half_diff * half_diff + t(k, k+1) * t(k+1, k));
+        const double root = std::sqrt(std::abs(disc));
+        if (disc < 0.0)
+        {
+          lambda[k]     = complex_t(theta,  root);
+          lambda[k + 1] = complex_t(theta, -root);
+        }
+        else
+        {
+          lambda[k]     = complex_t(theta + root, 0.0);
+          lambda[k + 1] = complex_t(theta - root, 0.0);
+        }
+      }
+    }
+    return lambda;
+  }
+
+  /// Classification of the eigenvalues of val
+  template< typename Matrix_T >
+  inline
+  eig_genus<Matrix_T>
+  real_schur<Matrix_T>::
+  classify() const
+  { return classify_eigenvalues<Matrix_T>(this->eigenvalues()); }
+
+  /// Principal square root of val
+  template< typename Matrix_T >
+  bool
+  real_schur<Matrix_T>::
+  sqrt(Matrix_T& result) const
+  {
+    dense_t root;
+    if (!this->m_valid || !quasi_triangular_sqrt(this->m_t, this->m_block_start, root))
+      return false;
+    this->back_transform(root, result);
+    return true;
+  }
+
+  /// Repeated principal square root of val, until the root is near the unit matrix
+  // This is the square root phase of the inverse scaling and squaring method for log.
+  // Reference: [HFM], Algorithm 11.9
+  template< typename Matrix_T >
+  bool
+  real_schur<Matrix_T>::
+  repeated_sqrt(const Scalar_T max_norm, const int max_steps, Matrix_T& result, int& nbr_steps) const
+  {
+    if (!this->m_valid)
+      return false;
+
+    const matrix_index_t dim = this->m_t.size1();
+    dense_t root = this->m_t;
+    for (nbr_steps = 0;
+        ;
+        ++nbr_steps)
+    {
+      // norm_frob2(root - 1)/dim, as for matrix_multi<>::norm()
+      Scalar_T norm_root_1 = Scalar_T(0);
+      for (matrix_index_t
+          row = 0;
+          row != dim;
+          ++row)
+        for (matrix_index_t
+            col = 0;
+            col != dim;
+            ++col)
+        {
+          const Scalar_T crd = (row == col) ? root(row, col) - Scalar_T(1) : root(row, col);
+          norm_root_1 += crd * crd;
+        }
+      if (norm_root_1 / Scalar_T(double(dim)) <= max_norm)
+        break;
+      if (nbr_steps == max_steps)
+        return false;
+
+      dense_t next_root;
+      if (!quasi_triangular_sqrt(root, this->m_block_start, next_root))
+        return false;
+      root.swap(next_root);
+    }
+    this->back_transform(root, result);
+    return true;
+  }
+
+  /// Principal square root of a quasi upper triangular matrix with the given diagonal blocks
+  // Each diagonal block of the result is the square root of the corresponding block of t.
+  // The blocks above the diagonal are then found a column of blocks at a time, from the
+  // diagonal upwards, by solving a Sylvester equation of dimension at most 4 for each block.
+  // Reference: [HFM], Section 6.2, Algorithm 6.7
+  template< typename Matrix_T >
+  bool
+  real_schur<Matrix_T>::
+  quasi_triangular_sqrt(const dense_t& t,
+                        const std::vector<matrix_index_t>& block_start,
+                        dense_t& result)
+  {
+    typedef numeric_traits<Scalar_T> traits_t;
+
+    const matrix_index_t dim = t.size1();
+    result.resize(dim, dim, false);
+    result.clear();
+    const std::size_t nbr_blocks = block_start.size() - 1;
+    for (std::size_t
+        j_block = 0;
+        j_block != nbr_blocks;
+        ++j_block)
+    {
+      const matrix_index_t j0 = block_start[j_block];
+      const matrix_index_t j_dim = block_start[j_block + 1] - j0;
+      if (j_dim == 1)
+      {
+        if (t(j0, j0) <= Scalar_T(0))
+          return false;
+        result(j0, j0) = traits_t::sqrt(t(j0, j0));
+      }
+      else
+      {
+        // For a 2x2 block b with positive determinant and no negative eigenvalues,
+        // sqrt(b) == (b + sqrt(det(b))) / sqrt(trace(b) + 2*sqrt(det(b))).
+        const Scalar_T a = t(j0,     j0);
+        const Scalar_T b = t(j0,     j0 + 1);
+        const Scalar_T c = t(j0 + 1, j0);
+        const Scalar_T d = t(j0 + 1, j0 + 1);
+        const Scalar_T det = a * d - b * c;
+        if (det <= Scalar_T(0))
+          return false;
+        const Scalar_T sqrt_det = traits_t::sqrt(det);
+        const Scalar_T theta = (a + d) / Scalar_T(2);
+        const Scalar_T half_diff = (a - d) / Scalar_T(2);
+        // theta + sqrt_det, avoiding cancellation when theta < 0
+        const Scalar_T theta_plus_sqrt_det = (theta >= Scalar_T(0))
+          ? theta + sqrt_det
+          : -(half_diff * half_diff + b * c) / (sqrt_det - theta);
+        if (theta_plus_sqrt_det <= Scalar_T(0))
+          return false;
+        const Scalar_T denom = traits_t::sqrt(Scalar_T(2) * theta_plus_sqrt_det);
+        result(j0,     j0)     = (a + sqrt_det) / denom;
+        result(j0,     j0 + 1) = b / denom;
+        result(j0 + 1, j0)     = c / denom;
+        result(j0 + 1, j0 + 1) = (d + sqrt_det) / denom;
+      }
+
+      Scalar_T rhs[4];
+      for (matrix_index_t
+          row = 0;
+          row != j_dim;
+          ++row)
+        for (matrix_index_t
+            col = 0;
+            col != j_dim;
+            ++col)
+          rhs[row * j_dim + col] = result(j0 + row, j0 + col);
+      for (std::size_t
+          i_block = j_block;
+          i_block-- != 0;
+          )
+      {
+        const matrix_index_t i0 = block_start[i_block];
+        const matrix_index_t i_dim = block_start[i_block + 1] - i0;
+        const matrix_index_t i_end = i0 + i_dim;
+
+        // c == t(i,j) - sum(result(i,k)*result(k,j)), over the blocks k between i and j,
+        // stored by columns
+        Scalar_T c[4];
+        for (matrix_index_t
+            col = 0;
+            col != j_dim;
+            ++col)
+          for (matrix_index_t
+              row = 0;
+              row != i_dim;
+              ++row)
+          {
+            Scalar_T crd = t(i0 + row, j0 + col);
+            for (matrix_index_t
+                k = i_end;
+                k != j0;
+                ++k)
+              crd -= result(i0 + row, k) * result(k, j0 + col);
+            c[row + i_dim * col] = crd;
+          }
+        Scalar_T lhs[4];
+        for (matrix_index_t
+            row = 0;
+            row != i_dim;
+            ++row)
+          for (matrix_index_t
+              col = 0;
+              col != i_dim;
+              ++col)
+            lhs[row * i_dim + col] = result(i0 + row, i0 + col);
+        if (!small_sylvester(lhs, i_dim, rhs, j_dim, c))
+          return false;
+        for (matrix_index_t
+            col = 0;
+            col != j_dim;
+            ++col)
+          for (matrix_index_t
+              row = 0;
+              row != i_dim;
+              ++row)
+            result(i0 + row, j0 + col) = c[row + i_dim * col];
+      }
+    }
+    return true;
+  }
+
+  /// Solve lhs * x + x * rhs == c for x, where lhs and rhs are 1x1 or 2x2
+  // lhs and rhs are stored by rows, and c and x by columns. The solution overwrites c.
+  // The Kronecker form (I (x) lhs + trans(rhs) (x) I) * vec(x) == vec(c), of dimension
+  // at most 4, is solved by Gaussian elimination with partial pivoting.
+  template< typename Matrix_T >
+  bool
+  real_schur<Matrix_T>::
+  small_sylvester(const Scalar_T* lhs, const matrix_index_t lhs_dim,
+                  const Scalar_T* rhs, const matrix_index_t rhs_dim,
+                  Scalar_T* c)
+  {
+    typedef numeric_traits<Scalar_T> traits_t;
+
+    const matrix_index_t n = lhs_dim * rhs_dim;
+    Scalar_T k[4][4];
+    for (matrix_index_t
+        col = 0;
+        col != rhs_dim;
+        ++col)
+      for (matrix_index_t
+          row = 0;
+          row != lhs_dim;
+          ++row)
+        for (matrix_index_t
+            col2 = 0;
+            col2 != rhs_dim;
+            ++col2)
+          for (matrix_index_t
+              row2 = 0;
+              row2 != lhs_dim;
+              ++row2)
+            k[row + lhs_dim * col][row2 + lhs_dim * col2] =
+              ((col == col2) ? lhs[row * lhs_dim + row2] : Scalar_T(0)) +
+              ((row == row2) ? rhs[col2 * rhs_dim + col] : Scalar_T(0));
+
+    for (matrix_index_t
+        piv = 0;
+        piv != n;
+        ++piv)
+    {
+      matrix_index_t max_row = piv;
+      for (matrix_index_t
+          row = piv + 1;
+          row != n;
+          ++row)
+        if (traits_t::abs(k[row][piv]) > traits_t::abs(k[max_row][piv]))
+          max_row = row;
+      if (k[max_row][piv] == Scalar_T(0))
+        return false;
+      if (max_row != piv)
+      {
+        for (matrix_index_t
+            col = piv;
+            col != n;
+            ++col)
+          std::swap(k[piv][col], k[max_row][col]);
+        std::swap(c[piv], c[max_row]);
+      }
+      for (matrix_index_t
+          row = piv + 1;
+          row != n;
+          ++row)
+      {
+        const Scalar_T factor = k[row][piv] / k[piv][piv];
+        for (matrix_index_t
+            col = piv + 1;
+            col != n;
+            ++col)
+          k[row][col] -= factor * k[piv][col];
+        c[row] -= factor * c[piv];
+      }
+    }
+    for (matrix_index_t
+        row = n;
+        row-- != 0;
+        )
+    {
+      for (matrix_index_t
+          col = row + 1;
+          col != n;
+          ++col)
+        c[row] -= k[row][col] * c[col];
+      c[row] /= k[row][row];
+    }
+    return true;
+  }
+
+  /// Q * val * trans(Q)
+  template< typename Matrix_T >
+  void
+  real_schur<Matrix_T>::
+  back_transform(const dense_t& val, Matrix_T& result) const
+  {
+    const matrix_index_t dim = val.size1();
+    dense_t q_val(dim, dim);
+    backend_t::prod(this->m_q, val, q_val, true);
+    const dense_t q_trans = ublas::trans(this->m_q);
+    dense_t q_val_q_trans(dim, dim);
+    backend_t::prod(q_val, q_trans, q_val_q_trans, true);
+    result = q_val_q_trans;
+  }
+} }
+#endif  // _GLUCAT_MATRIX_SCHUR_IMP_H
@@ -0,0 +1,346 @@
+#ifndef _GLUCAT_OPEN_HASH_MAP_H
+#define _GLUCAT_OPEN_HASH_MAP_H
+/***************************************************************************
+    GluCat : Generic library of universal Clifford algebra templates
+    open_hash_map.h : Hash map using open addressing with linear probing
+                             -------------------
+    begin                : Sat 2026-10-17
+    copyright            : (C) 2001-2016 by Paul C. Leopardi
+ ***************************************************************************
+
+    This library is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published
+    by the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with this library.  If not, see <http://www.gnu.org/licenses/>.
+
+ ***************************************************************************
+ This library is based on a prototype written by Arvind Raja and was
+ licensed under the LGPL with permission of the author. See Arvind Raja,
+ "Object-oriented implementations of Clifford algebras in C++: a prototype",
+ in Ablamowicz, Lounesto and Parra (eds.)
+ "Clifford algebras with numeric and symbolic computations, Birkhauser, 1996."
+ ***************************************************************************
+ See also Arvind Raja's original header comments and references in glucat.h
+ ***************************************************************************/
+
+#include <algorithm>
+#include <climits>
+#include <cstddef>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace glucat
+{
+  /// Hash map using open addressing with linear probing.
+  // Provides the subset of the std::unordered_map<> interface used by framed_multi<>,
+  // plus add(), which adds a value to the value of an existing key in a single probe.
+  // Each slot holds its (key, value) pair inline, so that lookups touch one contiguous array.
+  // The pairs are stored as std::pair<Key, T>, so that slots can be reassigned,
+  // and the iterators refer to the stored pairs: the key of a pair must not be modified through an iterator.
+  // The table size is a power of 2, and the hash is spread over the table by
+  // Fibonacci hashing, since Hash may leave the low bits poorly distributed.
+  // Erasure uses backward shift deletion, so there are no tombstones.
+  // Reference: D. E. Knuth, "The Art of Computer Programming", Vol. 3, 2nd ed., Section 6.4.
+  template< typename Key, typename T, typename Hash >
+  class open_hash_map
+  {
+  public:
+    typedef Key                                        key_type;
+    typedef T                                          mapped_type;
+    typedef std::pair<Key, T>                          value_type;
+    typedef Hash                                       hasher;
+    typedef std::size_t                                size_type;
+    typedef std::ptrdiff_t                             difference_type;
+
+  private:
+    /// Slot containing a pair and an occupancy flag
+    class slot_t
+    {
+    public:
+      slot_t()
+      : term(), used(false)
+      { }
+      value_type  term;
+      bool        used;
+    };
+    typedef std::vector<slot_t>                        slot_array_t;
+
+    /// Iterator over occupied slots: the array ends with a sentinel slot which is always used
+    template< typename Value_T, typename Slot_T >
+    class slot_iterator
+    {
+    public:
+      typedef std::forward_iterator_tag                iterator_category;
+      typedef Value_T                                  value_type;
+      typedef std::ptrdiff_t                           difference_type;
+      typedef Value_T*                                 pointer;
+      typedef Value_T&                                 reference;
+
+      slot_iterator()
+      : m_slot(0)
+      { }
+      explicit slot_iterator(Slot_T* slot)
+      : m_slot(slot)
+      { }
+      /// Convert an iterator into a const_iterator
+      template< typename Other_Value_T, typename Other_Slot_T >
+      slot_iterator(const slot_iterator<Other_Value_T, Other_Slot_T>& other)
+      : m_slot(other.m_slot)
+      { }
+      reference      operator*  () const
+      { return m_slot->term; }
+      pointer        operator-> () const
+      { return &m_slot->term; }
+      slot_iterator& operator++ ()
+      {
+        while (!(++m_slot)->used)
+          ;
+        return *this;
+      }
+      slot_iterator  operator++ (int)
+      {
+        const slot_iterator result = *this;
+        ++*this;
+        return result;
+      }
+      bool operator== (const slot_iterator& rhs) const
+      { return m_slot == rhs.m_slot; }
+      bool operator!= (const slot_iterator& rhs) const
+      { return m_slot != rhs.m_slot; }
+    private:
+      template< typename Other_Value_T, typename Other_Slot_T >
+      friend class slot_iterator;
+      friend class open_hash_map;
+      Slot_T* m_slot;
+    };
+
+  public:
+    typedef slot_iterator<value_type, slot_t>                   iterator;
+    typedef slot_iterator<const value_type, const slot_t>       const_iterator;
+
+    /// Default constructor
+    open_hash_map()
+    : m_slots(1), m_size(0), m_mask(0), m_shift(0)
+    { m_slots.back().used = true; }
+
+    /// Construct a map with room for at least n pairs before the table grows
+    explicit open_hash_map(const size_type n)
+    : m_slots(1), m_size(0), m_mask(0), m_shift(0)
+    {
+      m_slots.back().used = true;
+      if (n > 0)
+        rehash(capacity_for(n));
+    }
+
+    iterator       begin()
+    {
+      iterator it = iterator(&m_slots.front());
+      return it.m_slot->used ? it : ++it;
+    }
+    const_iterator begin() const
+    {
+      const_iterator it = const_iterator(&m_slots.front());
+      return it.m_slot->used ? it : ++it;
+    }
+    iterator       end()
+    { return iterator(&m_slots.back()); }
+    const_iterator end() const
+    { return const_iterator(&m_slots.back()); }
+
+    size_type size() const
+    { return m_size; }
+    bool      empty() const
+    { return m_size == 0; }
+    void      clear()
+    {
+      if (m_size == 0)
+        return;
+      const size_type nbr_slots = m_slots.size() - 1;
+      for (size_type
+          i = 0;
+          i != nbr_slots;
+          ++i)
+        m_slots[i].used = false;
+      m_size = 0;
+    }
+    void      swap(open_hash_map& other)
+    {
+      m_slots.swap(other.m_slots);
+      std::swap(m_size,  other.m_size);
+      std::swap(m_mask,  other.m_mask);
+      std::swap(m_shift, other.m_shift);
+    }
+
+    /// Find the pair with the given key
+    iterator       find(const key_type& key)
+    { return iterator(&m_slots[find_pos(key)]); }
+    const_iterator find(const key_type& key) const
+    { return const_iterator(&m_slots[find_pos(key)]); }
+
+    /// Insert a pair if its key is not already present
+    std::pair<iterator, bool> insert(const value_type& val)
+    {
+      if (m_mask == 0)
+        rehash(capacity_for(1));
+      size_type pos = probe(val.first);
+      if (m_slots[pos].used)
+        return std::make_pair(iterator(&m_slots[pos]), false);
+      if (m_size >= max_size_for(m_mask + 1))
+      {
+        rehash(capacity_for(m_size + 1));
+        pos = probe(val.first);
+      }
+      place(pos, val);
+      return std::make_pair(iterator(&m_slots[pos]), true);
+    }
+
+    /// Add val.second to the value for key val.first, erasing the pair if the sum is 0
+    void add(const value_type& val)
+    {
+      if (m_mask == 0)
+        rehash(capacity_for(1));
+      size_type pos = probe(val.first);
+      slot_t& slot = m_slots[pos];
+      if (slot.used)
+      {
+        if (slot.term.second + val.second == T(0))
+          erase_pos(pos);
+        else
+          slot.term.second += val.second;
+        return;
+      }
+      if (m_size >= max_size_for(m_mask + 1))
+      {
+        rehash(capacity_for(m_size + 1));
+        pos = probe(val.first);
+      }
+      place(pos, val);
+    }
+
+    /// Erase the pair at the given position
+    void erase(iterator pos)
+    { erase_pos(pos.m_slot - &m_slots.front()); }
+
+  private:
+    /// Largest number of pairs held by a table with nbr_slots slots: the load factor is at most 3/4
+    static size_type max_size_for(const size_type nbr_slots)
+    { return nbr_slots - (nbr_slots >> 2); }
+
+    /// Smallest power of 2 number of slots which can hold n pairs
+    static size_type capacity_for(const size_type n)
+    {
+      size_type nbr_slots = 4;
+      while (max_size_for(nbr_slots) < n)
+        nbr_slots <<= 1;
+      return nbr_slots;
+    }
+
+    /// Home slot of a key, using Fibonacci hashing
+    size_type home(const key_type& key) const
+    {
+      // 2^64 / golden ratio, or its low 32 bits where size_type has 32 bits
+      static const size_type golden =
+        ((size_type(0x9E3779B9UL) << 16) << 16) | size_type(0x7F4A7C15UL);
+      return (size_type(hasher()(key)) * golden) >> m_shift;
+    }
+
+    /// Slot containing key, or else the empty slot where key would be placed
+    size_type probe(const key_type& key) const
+    {
+      size_type pos = home(key);
+      while (m_slots[pos].used && !(m_slots[pos].term.first == key))
+        pos = (pos + 1) & m_mask;
+      return pos;
+    }
+
+    /// Slot containing key, or else the sentinel slot
+    size_type find_pos(const key_type& key) const
+    {
+      if (m_size == 0)
+        return m_slots.size() - 1;
+      const size_type pos = probe(key);
+      return m_slots[pos].used ? pos : m_slots.size() - 1;
+    }
+
+    /// Place a pair into an empty slot
+    void place(const size_type pos, const value_type& val)
+    {
+      slot_t& slot = m_slots[pos];
+      slot.term.first  = val.first;
+      slot.term.second = val.second;
+      slot.used = true;
+      ++m_size;
+    }
+
+    /// Empty a slot, then shift back any later pairs in its probe sequence
+    void erase_pos(size_type pos)
+    {
+      size_type next = pos;
+      for (;;)
+      {
+        next = (next + 1) & m_mask;
+        if (!m_slots[next].used)
+          break;
+        const size_type next_home = home(m_slots[next].term.first);
+        // Leave the pair at next in place if its home lies cyclically in (pos, next]
+        const bool in_place =
+          (pos <= next)
+          ? (pos < next_home && next_home <= next)
+          : (pos < next_home || next_home <= next);
+        if (!in_place)
+        {
+          m_slots[pos].term = m_slots[next].term;
+          pos = next;
+        }
+      }
+      m_slots[pos].used = false;
+      --m_size;
+    }
+
+    /// Move all pairs into a table with nbr_slots slots
+    void rehash(const size_type nbr_slots)
+    {
+      slot_array_t old_slots(nbr_slots + 1);
+      old_slots.swap(m_slots);
+      m_slots.back().used = true;
+      m_mask = nbr_slots - 1;
+      int log2_slots = 0;
+      while ((size_type(1) << log2_slots) < nbr_slots)
+        ++log2_slots;
+      m_shift = int(sizeof(size_type) * CHAR_BIT) - log2_slots;
+
+      const size_type nbr_old_slots = old_slots.size() - 1;
+      for (size_type
+          i = 0;
+          i != nbr_old_slots;
+          ++i)
+        if (old_slots[i].used)
+        {
+          size_type pos = home(old_slots[i].term.first);
+          while (m_slots[pos].used)
+            pos = (pos + 1) & m_mask;
+          m_slots[pos].term = old_slots[i].term;
+          m_slots[pos].used = true;
+        }
+    }
+
+    /// Slots, followed by a sentinel slot which is always used
+    slot_array_t m_slots;
+    /// Number of pairs
+    size_type    m_size;
+    /// Number of slots, less 1, or 0 if there are no slots
+    size_type    m_mask;
+    /// Shift used by Fibonacci hashing to obtain the home slot
+    int          m_shift;
+  };
+}
+#endif  // _GLUCAT_OPEN_HASH_MAP_H
@@ -48,6 +48,16 @@
 # define _GLUCAT_ISINF(x) (!_GLUCAT_ISNAN(x) && _GLUCAT_ISNAN(x-x))
 #endif
 
+// Use compiler builtins or the C++20 <bit> header, where available, for popcount and parity
+#if defined(__GNUC__)
+# define _GLUCAT_POPCOUNTL(x) (__builtin_popcountl(x))
+# define _GLUCAT_PARITYL(x)   (__builtin_parityl(x))
+#elif __cplusplus >= 202002L
+# include <bit>
+# define _GLUCAT_POPCOUNTL(x) (std::popcount(x))
+# define _GLUCAT_PARITYL(x)   (std::popcount(x) & 1)
+#endif
+
 // Workaround for abs and sqrt
 #if BOOST_VERSION >= 103400
 # define UBLAS_ABS  type_abs
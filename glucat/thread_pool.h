@@ -0,0 +1,215 @@
+#ifndef _GLUCAT_THREAD_POOL_H
+#define _GLUCAT_THREAD_POOL_H
+/***************************************************************************
+    GluCat : Generic library of universal Clifford algebra templates
+    thread_pool.h : Pool of worker threads for parallel loops
+                             -------------------
+    begin                : Sat 2026-10-17
+    copyright            : (C) 2001-2016 by Paul C. Leopardi
+ ***************************************************************************
+
+    This library is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published
+    by the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with this library.  If not, see <http://www.gnu.org/licenses/>.
+
+ ***************************************************************************
+ This library is based on a prototype written by Arvind Raja and was
+ licensed under the LGPL with permission of the author. See Arvind Raja,
+ "Object-oriented implementations of Clifford algebras in C++: a prototype",
+ in Ablamowicz, Lounesto and Parra (eds.)
+ "Clifford algebras with numeric and symbolic computations, Birkhauser, 1996."
+ ***************************************************************************
+ See also Arvind Raja's original header comments and references in glucat.h
+ ***************************************************************************/
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace glucat
+{
+  /// Pool of worker threads used to run the tasks of a parallel loop.
+  // Usage:
+  //   thread_pool::pool().run(nbr_tasks, task);
+  // calls task(k) for each k from 0 to nbr_tasks-1, spreading the calls over the
+  // worker threads and the calling thread, and returns when all calls have finished.
+  // If any call throws, run() rethrows the first exception once all calls have finished.
+  // The workers are created when the pool is first used, and wait between loops.
+  // Only one loop runs on the pool at a time: if the pool is busy, or if run()
+  // is called from within a task, the tasks run in turn on the calling thread.
+  class thread_pool
+  {
+  public:
+    /// Single instance of the thread pool
+    static thread_pool& pool()
+    {
+      static thread_pool the_pool;
+      return the_pool;
+    }
+    /// Number of threads which run tasks, including the calling thread
+    std::size_t size() const
+    { return this->m_workers.size() + 1; }
+
+    /// Call task(k) for each k from 0 to nbr_tasks-1, in parallel where possible
+    template< typename Task_T >
+    void run(const std::size_t nbr_tasks, Task_T& task)
+    {
+      std::unique_lock<std::mutex> busy(this->m_run_mutex, std::try_to_lock);
+      if (!busy.owns_lock() || in_task() || this->m_workers.empty() || nbr_tasks < 2)
+      {
+        for (std::size_t
+            k = 0;
+            k != nbr_tasks;
+            ++k)
+          task(k);
+        return;
+      }
+      {
+        std::lock_guard<std::mutex> lock(this->m_mutex);
+        this->m_call = &call_task<Task_T>;
+        this->m_task = &task;
+        this->m_nbr_tasks = nbr_tasks;
+        this->m_next = 0;
+        this->m_nbr_active = this->m_workers.size();
+        this->m_error = std::exception_ptr();
+        ++this->m_generation;
+      }
+      this->m_start.notify_all();
+      in_task() = true;
+      this->work();
+      in_task() = false;
+      std::unique_lock<std::mutex> lock(this->m_mutex);
+      while (this->m_nbr_active != 0)
+        this->m_done.wait(lock);
+      if (this->m_error)
+        std::rethrow_exception(this->m_error);
+    }
+  private:
+    /// Create one worker for each hardware thread other than the calling thread
+    thread_pool()
+    : m_call(0), m_task(0), m_nbr_tasks(0), m_next(0),
+      m_nbr_active(0), m_generation(0), m_stop(false)
+    {
+      const unsigned int nbr_threads = std::thread::hardware_concurrency();
+      for (unsigned int
+          i = 1;
+          i < nbr_threads;
+          ++i)
+        this->m_workers.push_back(std::thread(&thread_pool::worker_loop, this));
+    }
+    /// Stop and join the workers
+    ~thread_pool()
+    {
+      {
+        std::lock_guard<std::mutex> lock(this->m_mutex);
+        this->m_stop = true;
+      }
+      this->m_start.notify_all();
+      for (std::vector<std::thread>::iterator
+          worker_it = this->m_workers.begin();
+          worker_it != this->m_workers.end();
+          ++worker_it)
+        worker_it->join();
+    }
+    // Enforce singleton
+    // Reference: A. Alexandrescu, "Modern C++ Design", Chapter 6
+    thread_pool(const thread_pool&);
+    thread_pool& operator= (const thread_pool&);
+
+    /// Call a task of type Task_T
+    template< typename Task_T >
+    static void call_task(void* task, const std::size_t k)
+    { (*static_cast<Task_T*>(task))(k); }
+
+    /// Is the current thread running a task?
+    static bool& in_task()
+    {
+      static thread_local bool in_task_flag = false;
+      return in_task_flag;
+    }
+
+    /// Claim and call tasks until none are left
+    void work()
+    {
+      for (std::size_t
+          k = this->m_next++;
+          k < this->m_nbr_tasks;
+          k = this->m_next++)
+        try
+        {
+          this->m_call(this->m_task, k);
+        }
+        catch (...)
+        {
+          std::lock_guard<std::mutex> lock(this->m_mutex);
+          if (!this->m_error)
+            this->m_error = std::current_exception();
+        }
+    }
+
+    /// Wait for each loop, then help to run its tasks
+    void worker_loop()
+    {
+      in_task() = true;
+      std::size_t generation = 0;
+      for (;;)
+      {
+        {
+          std::unique_lock<std::mutex> lock(this->m_mutex);
+          while (this->m_generation == generation && !this->m_stop)
+            this->m_start.wait(lock);
+          if (this->m_stop)
+            return;
+          generation = this->m_generation;
+        }
+        this->work();
+        {
+          std::lock_guard<std::mutex> lock(this->m_mutex);
+          if (--this->m_nbr_active == 0)
+            this->m_done.notify_one();
+        }
+      }
+    }
+
+    /// Worker threads
+    std::vector<std::thread> m_workers;
+    /// Held by the thread which is running a loop on the pool
+    std::mutex               m_run_mutex;
+    /// Guards the state of the current loop
+    std::mutex               m_mutex;
+    /// Signalled when a loop starts, or when the pool stops
+    std::condition_variable  m_start;
+    /// Signalled when the last worker has finished a loop
+    std::condition_variable  m_done;
+    /// Function which calls a task of the current loop
+    void                   (*m_call)(void*, const std::size_t);
+    /// Task of the current loop
+    void*                    m_task;
+    /// Number of tasks in the current loop
+    std::size_t              m_nbr_tasks;
+    /// Next task to be claimed
+    std::atomic<std::size_t> m_next;
+    /// Number of workers which have not finished the current loop
+    std::size_t              m_nbr_active;
+    /// Number of loops started
+    std::size_t              m_generation;
+    /// First exception thrown by a task of the current loop
+    std::exception_ptr       m_error;
+    /// Set when the workers must stop
+    bool                     m_stop;
+  };
+}
+#endif  // _GLUCAT_THREAD_POOL_H
@@ -0,0 +1,273 @@
+#ifndef _GLUCAT_VECTOR_MULTI_H
+#define _GLUCAT_VECTOR_MULTI_H
+/***************************************************************************
+    GluCat : Generic library of universal Clifford algebra templates
+    vector_multi.h : Declare a class for the dense vector representation of a multivector
+                             -------------------
+    begin                : Sat 2026-10-17
+    copyright            : (C) 2001-2016 by Paul C. Leopardi
+ ***************************************************************************
+
+    This library is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published
+    by the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with this library.  If not, see <http://www.gnu.org/licenses/>.
+
+ ***************************************************************************
+ This library is based on a prototype written by Arvind Raja and was
+ licensed under the LGPL with permission of the author. See Arvind Raja,
+ "Object-oriented implementations of Clifford algebras in C++: a prototype",
+ in Ablamowicz, Lounesto and Parra (eds.)
+ "Clifford algebras with numeric and symbolic computations", Birkhauser, 1996.
+ ***************************************************************************
+     See also Arvind Raja's original header comments in glucat.h
+ ***************************************************************************/
+
+#include "glucat/global.h"
+#include "glucat/errors.h"
+#include "glucat/index_set.h"
+#include "glucat/clifford_algebra.h"
+#include "glucat/framed_multi.h"
+#include "glucat/aligned_allocator.h"
+
+#include <algorithm>
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace glucat
+{
+  // Forward declarations for friends
+
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  class framed_multi;  // forward
+
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  class matrix_multi;  // forward
+
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  class vector_multi;  // forward
+
+  /// Geometric product
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  const vector_multi<Scalar_T,LO,HI>
+  operator* (const vector_multi<Scalar_T,LO,HI>& lhs, const vector_multi<Scalar_T,LO,HI>& rhs);
+
+  /// Outer product
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  const vector_multi<Scalar_T,LO,HI>
+  operator^ (const vector_multi<Scalar_T,LO,HI>& lhs, const vector_multi<Scalar_T,LO,HI>& rhs);
+
+  /// Inner product
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  const vector_multi<Scalar_T,LO,HI>
+  operator& (const vector_multi<Scalar_T,LO,HI>& lhs, const vector_multi<Scalar_T,LO,HI>& rhs);
+
+  /// Left contraction
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  const vector_multi<Scalar_T,LO,HI>
+  operator% (const vector_multi<Scalar_T,LO,HI>& lhs, const vector_multi<Scalar_T,LO,HI>& rhs);
+
+  /// Hestenes scalar product
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  Scalar_T
+  star(const vector_multi<Scalar_T,LO,HI>& lhs, const vector_multi<Scalar_T,LO,HI>& rhs);
+
+  /// Geometric quotient
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  const vector_multi<Scalar_T,LO,HI>
+  operator/ (const vector_multi<Scalar_T,LO,HI>& lhs, const vector_multi<Scalar_T,LO,HI>& rhs);
+
+  /// Transformation via twisted adjoint action
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  const vector_multi<Scalar_T,LO,HI>
+  operator| (const vector_multi<Scalar_T,LO,HI>& lhs, const vector_multi<Scalar_T,LO,HI>& rhs);
+
+  /// Read multivector from input
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  std::istream&
+  operator>> (std::istream& s, vector_multi<Scalar_T,LO,HI>& val);
+
+  /// Write multivector to output
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  std::ostream&
+  operator<< (std::ostream& os, const vector_multi<Scalar_T,LO,HI>& val);
+
+  /// Find a common frame for operands of a binary operator
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  const index_set<LO,HI>
+  reframe (const vector_multi<Scalar_T,LO,HI>& lhs,    const vector_multi<Scalar_T,LO,HI>& rhs,
+                 vector_multi<Scalar_T,LO,HI>& lhs_reframed, vector_multi<Scalar_T,LO,HI>& rhs_reframed);
+
+  /// A vector_multi<Scalar_T,LO,HI> is a dense vector approximation to a multivector
+  template< typename Scalar_T = double, const index_t LO = DEFAULT_LO, const index_t HI = DEFAULT_HI >
+  class vector_multi :
+  public clifford_algebra< Scalar_T, index_set<LO,HI>, vector_multi<Scalar_T,LO,HI> >
+  {
+  public:
+    typedef vector_multi                               multivector_t;
+    typedef multivector_t                              vector_multi_t;
+    typedef Scalar_T                                   scalar_t;
+    typedef index_set<LO,HI>                           index_set_t;
+    typedef std::pair<const index_set_t, Scalar_T>     term_t;
+    typedef std::vector<Scalar_T>                      vector_t;
+    typedef error<multivector_t>                       error_t;
+    typedef      framed_multi<Scalar_T,LO,HI>          framed_multi_t;
+    typedef      matrix_multi<Scalar_T,LO,HI>          matrix_multi_t;
+    template< typename Other_Scalar_T, const index_t Other_LO, const index_t Other_HI >
+    friend class framed_multi;
+    template< typename Other_Scalar_T, const index_t Other_LO, const index_t Other_HI >
+    friend class matrix_multi;
+    template< typename Other_Scalar_T, const index_t Other_LO, const index_t Other_HI >
+    friend class vector_multi;
+
+  private:
+    /// Dense array of coordinates, indexed by the value of the fold of each index set
+    // The array starts on a cache line boundary, so that the product loops can use aligned vector loads
+    typedef std::vector< Scalar_T, aligned_allocator<Scalar_T> >
+                                                       array_t;
+    typedef typename array_t::size_type                array_index_t;
+
+  public:
+    /// Class name used in messages
+    static const std::string classname();
+    /// Destructor
+    ~vector_multi() {};
+    /// Default constructor
+    vector_multi();
+    /// Construct a multivector from a multivector with a different scalar type
+    template< typename Other_Scalar_T >
+    vector_multi(const vector_multi<Other_Scalar_T,LO,HI>& val);
+    /// Construct a multivector, within a given frame, from a given multivector
+    template< typename Other_Scalar_T >
+    vector_multi(const vector_multi<Other_Scalar_T,LO,HI>& val,
+                 const index_set_t frm, const bool prechecked = false);
+    /// Construct a multivector, within a given frame, from a given multivector
+    vector_multi(const multivector_t& val,
+                 const index_set_t frm, const bool prechecked = false);
+    /// Construct a multivector from an index set and a scalar coordinate
+    vector_multi(const index_set_t ist, const Scalar_T& crd = Scalar_T(1));
+    /// Construct a multivector, within a given frame, from an index set and a scalar coordinate
+    vector_multi(const index_set_t ist, const Scalar_T& crd,
+                 const index_set_t frm, const bool prechecked = false);
+    /// Construct a multivector from a scalar (within a frame, if given)
+    vector_multi(const Scalar_T& scr, const index_set_t frm = index_set_t());
+    /// Construct a multivector from an int (within a frame, if given)
+    vector_multi(const int scr, const index_set_t frm = index_set_t());
+    /// Construct a multivector from the value of a lazy expression
+    template< typename Expr_T >
+    vector_multi(const lazy_expr<Expr_T, multivector_t>& expr);
+    /// Construct a multivector, within a given frame, from a given vector
+    vector_multi(const vector_t& vec,
+                 const index_set_t frm, const bool prechecked = false);
+    /// Construct a multivector from a string: eg: "3+2{1,2}-6.1e-2{2,3}"
+    vector_multi(const std::string& str);
+    /// Construct a multivector, within a given frame, from a string: eg: "3+2{1,2}-6.1e-2{2,3}"
+    vector_multi(const std::string& str,
+                 const index_set_t frm, const bool prechecked = false);
+    /// Construct a multivector from a char*: eg: "3+2{1,2}-6.1e-2{2,3}"
+    vector_multi(const char* str)
+    { *this = vector_multi(std::string(str)); };
+    /// Construct a multivector, within a given frame, from a char*: eg: "3+2{1,2}-6.1e-2{2,3}"
+    vector_multi(const char* str,
+                 const index_set_t frm, const bool prechecked = false)
+    { *this = vector_multi(std::string(str), frm, prechecked); };
+    /// Construct a multivector from a framed_multi_t
+    template< typename Other_Scalar_T >
+    vector_multi(const framed_multi<Other_Scalar_T,LO,HI>& val);
+    /// Construct a multivector, within a given frame, from a framed_multi_t
+    template< typename Other_Scalar_T >
+    vector_multi(const framed_multi<Other_Scalar_T,LO,HI>& val,
+                 const index_set_t frm, const bool prechecked = false);
+    /// Construct a multivector from a matrix_multi_t
+    template< typename Other_Scalar_T >
+    vector_multi(const matrix_multi<Other_Scalar_T,LO,HI>& val);
+
+    _GLUCAT_CLIFFORD_ALGEBRA_OPERATIONS
+
+    /// Number of terms
+    unsigned long nbr_terms() const;
+
+    /// Random multivector within a frame
+    static const vector_multi_t random(const index_set_t frm, Scalar_T fill = Scalar_T(1));
+
+    // Friend declarations
+
+    friend const vector_multi_t
+      operator* <>(const vector_multi_t& lhs, const vector_multi_t& rhs);
+    friend const vector_multi_t
+      operator^ <>(const vector_multi_t& lhs, const vector_multi_t& rhs);
+    friend const vector_multi_t
+      operator& <>(const vector_multi_t& lhs, const vector_multi_t& rhs);
+    friend const vector_multi_t
+      operator% <>(const vector_multi_t& lhs, const vector_multi_t& rhs);
+    friend Scalar_T
+      star      <>(const vector_multi_t& lhs, const vector_multi_t& rhs);
+    friend const vector_multi_t
+      operator/ <>(const vector_multi_t& lhs, const vector_multi_t& rhs);
+    friend const vector_multi_t
+      operator| <>(const vector_multi_t& lhs, const vector_multi_t& rhs);
+
+    friend std::istream&
+      operator>> <>(std::istream& s, multivector_t& val);
+    friend std::ostream&
+      operator<< <>(std::ostream& os, const multivector_t& val);
+
+    template< typename Other_Scalar_T, const index_t Other_LO, const index_t Other_HI >
+    friend const index_set<Other_LO,Other_HI>
+    reframe (const vector_multi<Other_Scalar_T,Other_LO,Other_HI>& lhs,    const vector_multi<Other_Scalar_T,Other_LO,Other_HI>& rhs,
+                   vector_multi<Other_Scalar_T,Other_LO,Other_HI>& lhs_reframed, vector_multi<Other_Scalar_T,Other_LO,Other_HI>& rhs_reframed);
+
+    /// Add a term, if non-zero
+    multivector_t&     operator+= (const term_t& term);
+
+  private:
+    /// Set the frame and resize the coordinate array to match, clearing all coordinates
+    void               reset_frame(const index_set_t frm);
+    /// Replace the value of this multivector by the value of val, leaving val unspecified
+    multivector_t&     take_value(multivector_t& val);
+
+    // Data members
+
+    /// Index set representing the frame for the subalgebra which contains the multivector
+    index_set_t        m_frame;
+    /// Coordinates of the multivector, indexed by the value of the fold within m_frame
+    array_t            m_array;
+  };
+
+  // Non-members
+
+  /// Square root of multivector with specified complexifier
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  const vector_multi<Scalar_T,LO,HI>
+  sqrt(const vector_multi<Scalar_T,LO,HI>& val, const vector_multi<Scalar_T,LO,HI>& i, bool prechecked);
+
+  /// Exponential of multivector
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  const vector_multi<Scalar_T,LO,HI>
+  exp(const vector_multi<Scalar_T,LO,HI>& val);
+
+  /// Natural logarithm of multivector with specified complexifier
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  const vector_multi<Scalar_T,LO,HI>
+  log(const vector_multi<Scalar_T,LO,HI>& val, const vector_multi<Scalar_T,LO,HI>& i, bool prechecked);
+}
+
+namespace std
+{
+  /// Numeric limits for vector_multi inherit limits for the corresponding scalar type
+  template <typename Scalar_T, const glucat::index_t LO, const glucat::index_t HI>
+  struct numeric_limits< glucat::vector_multi<Scalar_T,LO,HI> > :
+  public numeric_limits<Scalar_T>
+  { };
+}
+#endif  // _GLUCAT_VECTOR_MULTI_H
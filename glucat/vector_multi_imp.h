@@ -0,0 +1,1500 @@
+#ifndef _GLUCAT_VECTOR_MULTI_IMP_H
+#define _GLUCAT_VECTOR_MULTI_IMP_H
+/***************************************************************************
+    GluCat : Generic library of universal Clifford algebra templates
+    vector_multi_imp.h : Implement the dense vector representation of a multivector
+                             -------------------
+    begin                : Sat 2026-10-17
+    copyright            : (C) 2001-2016 by Paul C. Leopardi
+ ***************************************************************************
+
+    This library is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published
+    by the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with this library.  If not, see <http://www.gnu.org/licenses/>.
+
+ ***************************************************************************
+ This library is based on a prototype written by Arvind Raja and was
+ licensed under the LGPL with permission of the author. See Arvind Raja,
+ "Object-oriented implementations of Clifford algebras in C++: a prototype",
+ in Ablamowicz, Lounesto and Parra (eds.)
+ "Clifford algebras with numeric and symbolic computations", Birkhauser, 1996.
+ ***************************************************************************
+     See also Arvind Raja's original header comments in glucat.h
+ ***************************************************************************/
+
+#include "glucat/vector_multi.h"
+
+#include <fstream>
+
+namespace glucat
+{
+  // References for algorithms:
+  // [JA]: Joerg Arndt, "Matters Computational", Springer, 2010.
+  // [L]: Pertti Lounesto, "Clifford algebras and spinors", Cambridge UP, 1997.
+
+  // Within a frame, each index set is represented by the value of its fold,
+  // in which the negative indices of the frame occupy the low bits, in increasing order,
+  // followed by the positive indices, in increasing order.
+
+  /// Mask used to obtain the sign of the geometric product of a folded basis element with any other
+  inline
+  static
+  set_value_t
+  folded_mult_mask(const set_value_t lhs, const set_value_t neg_mask)
+  {
+    // Bit j of the result is the parity of the number of bits of lhs above j,
+    // that is, the number of transpositions needed to move generator j past lhs,
+    // toggled if generator j is negative and is also contained in lhs.
+    // The sign of lhs * rhs is then (-1)^parity(rhs & mask).
+    // Reference: [L] Chapter 21, 21.3
+    return inverse_gray(lhs >> 1) ^ (lhs & neg_mask);
+  }
+
+  /// Sign of geometric square of a folded basis element
+  inline
+  static
+  int
+  folded_sign_of_square(const set_value_t stv, const set_value_t neg_mask)
+  {
+    const int rev_sign = ((bit_count(stv) % 4) > 1) ? -1 : 1;
+    return bit_parity(stv & neg_mask) ? -rev_sign : rev_sign;
+  }
+
+  /// Class name used in messages
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  const std::string
+  vector_multi<Scalar_T,LO,HI>::
+  classname()
+  { return "vector_multi"; }
+
+  /// Set the frame and resize the coordinate array to match, clearing all coordinates
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  inline
+  void
+  vector_multi<Scalar_T,LO,HI>::
+  reset_frame(const index_set_t frm)
+  {
+    this->m_frame = frm;
+    this->m_array.assign(array_index_t(1) << frm.count(), Scalar_T(0));
+  }
+
+  /// Replace the value of this multivector by the value of val, leaving val unspecified
+  // The coordinate arrays are exchanged rather than copied.
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  inline
+  vector_multi<Scalar_T,LO,HI>&
+  vector_multi<Scalar_T,LO,HI>::
+  take_value(multivector_t& val)
+  {
+    this->m_frame = val.m_frame;
+    this->m_array.swap(val.m_array);
+    return *this;
+  }
+
+  /// Default constructor
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  vector_multi<Scalar_T,LO,HI>::
+  vector_multi()
+  : m_frame( index_set_t() ),
+    m_array( 1, Scalar_T(0) )
+  { }
+
+  /// Construct a multivector from a multivector with a different scalar type
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  template< typename Other_Scalar_T >
+  vector_multi<Scalar_T,LO,HI>::
+  vector_multi(const vector_multi<Other_Scalar_T,LO,HI>& val)
+  : m_frame( val.m_frame ),
+    m_array( val.m_array.size() )
+  {
+    typedef numeric_traits<Scalar_T> traits_t;
+    for (array_index_t
+        stv = 0;
+        stv != this->m_array.size();
+        ++stv)
+      this->m_array[stv] = traits_t::to_scalar_t(val.m_array[stv]);
+  }
+
+  /// Construct a multivector, within a given frame, from a given multivector
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  template< typename Other_Scalar_T >
+  vector_multi<Scalar_T,LO,HI>::
+  vector_multi(const vector_multi<Other_Scalar_T,LO,HI>& val, const index_set_t frm, const bool prechecked)
+  { *this = multivector_t(multivector_t(val), frm, prechecked); }
+
+  /// Construct a multivector, within a given frame, from a given multivector
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  vector_multi<Scalar_T,LO,HI>::
+  vector_multi(const multivector_t& val, const index_set_t frm, const bool prechecked)
+  {
+    if (!prechecked && (val.m_frame | frm) != frm)
+      throw error_t("multivector_t(val,frm): cannot initialize with value outside of frame");
+    const index_set_t our_frame = frm;
+    if (our_frame == val.m_frame)
+    {
+      *this = val;
+      return;
+    }
+    this->reset_frame(our_frame);
+
+    // Find the position of each folded generator of val.m_frame within the fold of our_frame
+    const index_t val_count = val.m_frame.count();
+    std::vector<set_value_t> bit_of(val_count);
+    index_t val_bit = 0;
+    index_t our_bit = 0;
+    const index_t end_index = our_frame.max()+1;
+    for (index_t
+        idx = our_frame.min();
+        idx != end_index;
+        ++idx)
+      if (our_frame[idx])
+      {
+        if (val.m_frame[idx])
+          bit_of[val_bit++] = set_value_t(1) << our_bit;
+        ++our_bit;
+      }
+    const array_index_t val_dim = val.m_array.size();
+    for (array_index_t
+        stv = 0;
+        stv != val_dim;
+        ++stv)
+    {
+      const Scalar_T& crd = val.m_array[stv];
+      if (crd != Scalar_T(0))
+      {
+        set_value_t result_stv = 0;
+        for (index_t
+            k = 0;
+            k != val_count;
+            ++k)
+          if (stv & (set_value_t(1) << k))
+            result_stv |= bit_of[k];
+        this->m_array[result_stv] = crd;
+      }
+    }
+  }
+
+  /// Construct a multivector from an index set and a scalar coordinate
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  vector_multi<Scalar_T,LO,HI>::
+  vector_multi(const index_set_t ist, const Scalar_T& crd)
+  {
+    this->reset_frame(ist);
+    *this += term_t(ist, crd);
+  }
+
+  /// Construct a multivector, within a given frame, from an index set and a scalar coordinate
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  vector_multi<Scalar_T,LO,HI>::
+  vector_multi(const index_set_t ist, const Scalar_T& crd, const index_set_t frm, const bool prechecked)
+  {
+    if (!prechecked && (ist | frm) != frm)
+      throw error_t("multivector_t(ist,crd,frm): cannot initialize with value outside of frame");
+    this->reset_frame(frm);
+    *this += term_t(ist, crd);
+  }
+
+  /// Construct a multivector from a scalar (within a frame, if given)
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  vector_multi<Scalar_T,LO,HI>::
+  vector_multi(const Scalar_T& scr, const index_set_t frm)
+  {
+    this->reset_frame(frm);
+    this->m_array[0] = scr;
+  }
+
+  /// Construct a multivector from an int (within a frame, if given)
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  vector_multi<Scalar_T,LO,HI>::
+  vector_multi(const int scr, const index_set_t frm)
+  {
+    this->reset_frame(frm);
+    this->m_array[0] = Scalar_T(scr);
+  }
+
+  /// Construct a multivector from the value of a lazy expression
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  template< typename Expr_T >
+  vector_multi<Scalar_T,LO,HI>::
+  vector_multi(const lazy_expr<Expr_T, multivector_t>& expr)
+  { lazy_eval(*this, expr); }
+
+  /// Construct a multivector, within a given frame, from a given vector
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  vector_multi<Scalar_T,LO,HI>::
+  vector_multi(const vector_t& vec,
+               const index_set_t frm, const bool prechecked)
+  {
+    if (!prechecked && index_t(vec.size()) != frm.count())
+      throw error_t("multivector_t(vec,frm): cannot initialize with vector not matching frame");
+    this->reset_frame(frm);
+    // The generators of frm are folded in increasing order of index
+    for (array_index_t
+        k = 0;
+        k != vec.size();
+        ++k)
+      this->m_array[array_index_t(1) << k] = vec[k];
+  }
+
+  /// Construct a multivector from a string: eg: "3+2{1,2}-6.1e-2{2,3}"
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  vector_multi<Scalar_T,LO,HI>::
+  vector_multi(const std::string& str)
+  { *this = framed_multi_t(str); }
+
+  /// Construct a multivector, within a given frame, from a string: eg: "3+2{1,2}-6.1e-2{2,3}"
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  vector_multi<Scalar_T,LO,HI>::
+  vector_multi(const std::string& str, const index_set_t frm, const bool prechecked)
+  { *this = multivector_t(framed_multi_t(str), frm, prechecked); }
+
+  /// Construct a multivector from a framed_multi_t
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  template< typename Other_Scalar_T >
+  vector_multi<Scalar_T,LO,HI>::
+  vector_multi(const framed_multi<Other_Scalar_T,LO,HI>& val)
+  { *this = multivector_t(val, val.frame(), true); }
+
+  /// Construct a multivector, within a given frame, from a framed_multi_t
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  template< typename Other_Scalar_T >
+  vector_multi<Scalar_T,LO,HI>::
+  vector_multi(const framed_multi<Other_Scalar_T,LO,HI>& val, const index_set_t frm, const bool prechecked)
+  {
+    if (!prechecked && (val.frame() | frm) != frm)
+      throw error_t("multivector_t(val,frm): cannot initialize with value outside of frame");
+    this->reset_frame(frm);
+
+    typedef numeric_traits<Scalar_T> traits_t;
+    typedef framed_multi<Other_Scalar_T,LO,HI> other_framed_multi_t;
+    for (typename other_framed_multi_t::const_iterator
+        val_it = val.begin();
+        val_it != val.end();
+        ++val_it)
+      this->m_array[val_it->first.value_of_fold(frm)] = traits_t::to_scalar_t(val_it->second);
+  }
+
+  /// Construct a multivector from a matrix_multi_t
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  template< typename Other_Scalar_T >
+  vector_multi<Scalar_T,LO,HI>::
+  vector_multi(const matrix_multi<Other_Scalar_T,LO,HI>& val)
+  { *this = framed_multi_t(val); }
+
+  /// Find a common frame for operands of a binary operator
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  inline
+  const index_set<LO,HI>
+  reframe (const vector_multi<Scalar_T,LO,HI>& lhs,    const vector_multi<Scalar_T,LO,HI>& rhs,
+                 vector_multi<Scalar_T,LO,HI>& lhs_reframed, vector_multi<Scalar_T,LO,HI>& rhs_reframed)
+  {
+    typedef index_set<LO,HI> index_set_t;
+    typedef vector_multi<Scalar_T,LO,HI> multivector_t;
+    const index_set_t our_frame = lhs.m_frame | rhs.m_frame;
+    // Do the reframing only where necessary
+    if (lhs.m_frame != our_frame)
+      lhs_reframed = multivector_t(lhs, our_frame, true);
+    if (rhs.m_frame != our_frame)
+      rhs_reframed = multivector_t(rhs, our_frame, true);
+    return our_frame;
+  }
+
+  /// Test for equality of multivectors
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  bool
+  vector_multi<Scalar_T,LO,HI>::
+  operator==  (const multivector_t& rhs) const
+  {
+    // Ensure that there is no aliasing
+    if (this == &rhs)
+      return true;
+
+    // Operate only within a common frame
+    multivector_t lhs_reframed;
+    multivector_t rhs_reframed;
+    const index_set_t our_frame = reframe(*this, rhs, lhs_reframed, rhs_reframed);
+    const multivector_t& lhs_ref = (this->m_frame == our_frame)
+      ? *this
+      : lhs_reframed;
+    const multivector_t& rhs_ref = (rhs.m_frame == our_frame)
+      ? rhs
+      : rhs_reframed;
+
+    return lhs_ref.m_array == rhs_ref.m_array;
+  }
+
+  /// Test for equality of multivector and scalar
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  bool
+  vector_multi<Scalar_T,LO,HI>::
+  operator==  (const Scalar_T& scr) const
+  {
+    if (this->m_array[0] != scr)
+      return false;
+    const array_index_t dim = this->m_array.size();
+    for (array_index_t
+        stv = 1;
+        stv != dim;
+        ++stv)
+      if (this->m_array[stv] != Scalar_T(0))
+        return false;
+    return true;
+  }
+
+  /// Geometric sum of multivector and scalar
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  inline
+  vector_multi<Scalar_T,LO,HI>&
+  vector_multi<Scalar_T,LO,HI>::
+  operator+= (const Scalar_T& scr)
+  {
+    this->m_array[0] += scr;
+    return *this;
+  }
+
+  /// Geometric sum
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  vector_multi<Scalar_T,LO,HI>&
+  vector_multi<Scalar_T,LO,HI>::
+  operator+= (const multivector_t& rhs)
+  {
+    // Ensure that there is no aliasing
+    if (this == &rhs)
+      return *this *= Scalar_T(2);
+
+    // Operate only within a common frame
+    multivector_t rhs_reframed;
+    const index_set_t our_frame = reframe(*this, rhs, *this, rhs_reframed);
+    const multivector_t& rhs_ref = (rhs.m_frame == our_frame)
+      ? rhs
+      : rhs_reframed;
+
+    const array_index_t dim = this->m_array.size();
+    Scalar_T* this_crd = &(this->m_array[0]);
+    const Scalar_T* rhs_crd = &(rhs_ref.m_array[0]);
+    for (array_index_t
+        stv = 0;
+        stv != dim;
+        ++stv)
+      this_crd[stv] += rhs_crd[stv];
+    return *this;
+  }
+
+  /// Geometric difference
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  vector_multi<Scalar_T,LO,HI>&
+  vector_multi<Scalar_T,LO,HI>::
+  operator-= (const multivector_t& rhs)
+  {
+    // Ensure that there is no aliasing
+    if (this == &rhs)
+      return *this = Scalar_T(0);
+
+    // Operate only within a common frame
+    multivector_t rhs_reframed;
+    const index_set_t our_frame = reframe(*this, rhs, *this, rhs_reframed);
+    const multivector_t& rhs_ref = (rhs.m_frame == our_frame)
+      ? rhs
+      : rhs_reframed;
+
+    const array_index_t dim = this->m_array.size();
+    Scalar_T* this_crd = &(this->m_array[0]);
+    const Scalar_T* rhs_crd = &(rhs_ref.m_array[0]);
+    for (array_index_t
+        stv = 0;
+        stv != dim;
+        ++stv)
+      this_crd[stv] -= rhs_crd[stv];
+    return *this;
+  }
+
+  /// Geometric sum of multivector and product of multivector and scalar
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  vector_multi<Scalar_T,LO,HI>&
+  vector_multi<Scalar_T,LO,HI>::
+  add_scaled(const multivector_t& rhs, const Scalar_T& crd)
+  {
+    typedef numeric_traits<Scalar_T> traits_t;
+
+    // Fuse the product and sum only within the same frame
+    if (&rhs == this || crd == Scalar_T(0) || traits_t::isNaN_or_isInf(crd)
+        || rhs.m_frame != this->m_frame)
+      return *this += rhs * crd;
+
+    const array_index_t dim = this->m_array.size();
+    Scalar_T* this_crd = &(this->m_array[0]);
+    const Scalar_T* rhs_crd = &(rhs.m_array[0]);
+    for (array_index_t
+        stv = 0;
+        stv != dim;
+        ++stv)
+      this_crd[stv] += rhs_crd[stv] * crd;
+    return *this;
+  }
+
+  /// Assign the value of a lazy expression
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  template< typename Expr_T >
+  inline
+  vector_multi<Scalar_T,LO,HI>&
+  vector_multi<Scalar_T,LO,HI>::
+  operator= (const lazy_expr<Expr_T, multivector_t>& rhs)
+  { return lazy_assign(*this, rhs); }
+
+  /// Geometric sum of multivector and lazy expression
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  template< typename Expr_T >
+  inline
+  vector_multi<Scalar_T,LO,HI>&
+  vector_multi<Scalar_T,LO,HI>::
+  operator+= (const lazy_expr<Expr_T, multivector_t>& rhs)
+  { return lazy_add(*this, rhs, Scalar_T(1)); }
+
+  /// Geometric difference of multivector and lazy expression
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  template< typename Expr_T >
+  inline
+  vector_multi<Scalar_T,LO,HI>&
+  vector_multi<Scalar_T,LO,HI>::
+  operator-= (const lazy_expr<Expr_T, multivector_t>& rhs)
+  { return lazy_add(*this, rhs, Scalar_T(-1)); }
+
+  /// Unary -
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  inline
+  const vector_multi<Scalar_T,LO,HI>
+  vector_multi<Scalar_T,LO,HI>::
+  operator- () const
+  {
+    multivector_t result = *this;
+    return result *= Scalar_T(-1);
+  }
+
+  /// Product of multivector and scalar
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  vector_multi<Scalar_T,LO,HI>&
+  vector_multi<Scalar_T,LO,HI>::
+  operator*= (const Scalar_T& scr)
+  { // multiply coordinates of all terms by scalar
+    typedef numeric_traits<Scalar_T> traits_t;
+
+    if (traits_t::isNaN_or_isInf(scr))
+      return *this = traits_t::NaN();
+    if (scr == Scalar_T(0))
+    {
+      if (this->isnan())
+        *this = traits_t::NaN();
+      else
+        this->m_array.assign(this->m_array.size(), Scalar_T(0));
+    }
+    else
+    {
+      const array_index_t dim = this->m_array.size();
+      Scalar_T* this_crd = &(this->m_array[0]);
+      for (array_index_t
+          stv = 0;
+          stv != dim;
+          ++stv)
+        this_crd[stv] *= scr;
+    }
+    return *this;
+  }
+
+  /// Geometric product
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  const vector_multi<Scalar_T,LO,HI>
+  operator* (const vector_multi<Scalar_T,LO,HI>& lhs, const vector_multi<Scalar_T,LO,HI>& rhs)
+  {
+    typedef vector_multi<Scalar_T,LO,HI> multivector_t;
+    typedef typename multivector_t::index_set_t index_set_t;
+    typedef typename multivector_t::array_index_t array_index_t;
+    typedef typename multivector_t::array_t array_t;
+
+#if defined(_GLUCAT_CHECK_ISNAN)
+    if (lhs.isnan() || rhs.isnan())
+      return numeric_traits<Scalar_T>::NaN();
+#endif
+
+    // Operate only within a common frame
+    multivector_t lhs_reframed;
+    multivector_t rhs_reframed;
+    const index_set_t our_frame = reframe(lhs, rhs, lhs_reframed, rhs_reframed);
+    const multivector_t& lhs_ref = (lhs.m_frame == our_frame)
+      ? lhs
+      : lhs_reframed;
+    const multivector_t& rhs_ref = (rhs.m_frame == our_frame)
+      ? rhs
+      : rhs_reframed;
+
+    if (our_frame.count() >= Tune_P::dense_mult_matrix_threshold)
+    { // Past a certain threshold, the matrix algorithm is fastest
+      typedef typename multivector_t::framed_multi_t framed_multi_t;
+      typedef typename multivector_t::matrix_multi_t matrix_multi_t;
+      return matrix_multi_t(framed_multi_t(lhs_ref), our_frame, true) *
+             matrix_multi_t(framed_multi_t(rhs_ref), our_frame, true);
+    }
+
+    const set_value_t neg_mask = (set_value_t(1) << our_frame.count_neg()) - 1;
+    const array_index_t dim = lhs_ref.m_array.size();
+    multivector_t result = multivector_t(Scalar_T(0), our_frame);
+    Scalar_T* result_crd = &(result.m_array[0]);
+    const Scalar_T* lhs_crd = &(lhs_ref.m_array[0]);
+    const Scalar_T* rhs_crd = &(rhs_ref.m_array[0]);
+    // Number of coordinates in each block of the blocked dense algorithm
+    static const array_index_t block_dim = 8;
+    if (dim < block_dim)
+    { // Dense algorithm: for each lhs basis element, run a branch-free loop over rhs
+      for (array_index_t
+          lhs_stv = 0;
+          lhs_stv != dim;
+          ++lhs_stv)
+      {
+        const Scalar_T lhs_val = lhs_crd[lhs_stv];
+        if (lhs_val == Scalar_T(0))
+          continue;
+        const Scalar_T signed_lhs_val[2] = {lhs_val, -lhs_val};
+        const set_value_t mask = folded_mult_mask(lhs_stv, neg_mask);
+        for (array_index_t
+            rhs_stv = 0;
+            rhs_stv != dim;
+            ++rhs_stv)
+          result_crd[lhs_stv ^ rhs_stv] +=
+            signed_lhs_val[bit_parity(rhs_stv & mask)] * rhs_crd[rhs_stv];
+      }
+      return result;
+    }
+    // Blocked dense algorithm, whose inner loops run over contiguous blocks of block_dim coordinates.
+    // Split each index into a block and an offset within the block: lhs_stv = lhs_block + lhs_low.
+    // The product of lhs_stv with rhs_block + rhs_low goes to (lhs_block ^ rhs_block) + (lhs_low ^ rhs_low),
+    // so the lhs terms with a given lhs_low are summed into acc_crd, indexed by the result index xor lhs_low.
+    // The sign of the product is the parity of rhs_stv & mask, which is the parity of rhs_block & mask,
+    // constant over the block, times the parity of rhs_low & mask, which is kept in signed_lhs_val.
+    array_t acc_array(dim);
+    Scalar_T* acc_crd = &(acc_array[0]);
+    Scalar_T signed_lhs_val[block_dim];
+    for (array_index_t
+        lhs_low = 0;
+        lhs_low != block_dim;
+        ++lhs_low)
+    {
+      bool acc_is_zero = true;
+      for (array_index_t
+          lhs_block = 0;
+          lhs_block != dim;
+          lhs_block += block_dim)
+      {
+        const array_index_t lhs_stv = lhs_block + lhs_low;
+        const Scalar_T lhs_val = lhs_crd[lhs_stv];
+        if (lhs_val == Scalar_T(0))
+          continue;
+        if (acc_is_zero)
+        {
+          std::fill(acc_crd, acc_crd + dim, Scalar_T(0));
+          acc_is_zero = false;
+        }
+        const set_value_t mask = folded_mult_mask(lhs_stv, neg_mask);
+        for (array_index_t
+            rhs_low = 0;
+            rhs_low != block_dim;
+            ++rhs_low)
+          signed_lhs_val[rhs_low] = bit_parity(rhs_low & mask) ? -lhs_val : lhs_val;
+        for (array_index_t
+            rhs_block = 0;
+            rhs_block != dim;
+            rhs_block += block_dim)
+        {
+          Scalar_T* acc_block = acc_crd + (lhs_block ^ rhs_block);
+          const Scalar_T* rhs_block_crd = rhs_crd + rhs_block;
+          if (bit_parity(rhs_block & mask))
+            for (array_index_t
+                rhs_low = 0;
+                rhs_low != block_dim;
+                ++rhs_low)
+              acc_block[rhs_low] -= signed_lhs_val[rhs_low] * rhs_block_crd[rhs_low];
+          else
+            for (array_index_t
+                rhs_low = 0;
+                rhs_low != block_dim;
+                ++rhs_low)
+              acc_block[rhs_low] += signed_lhs_val[rhs_low] * rhs_block_crd[rhs_low];
+        }
+      }
+      if (!acc_is_zero)
+        for (array_index_t
+            stv = 0;
+            stv != dim;
+            ++stv)
+          result_crd[stv ^ lhs_low] += acc_crd[stv];
+    }
+    return result;
+  }
+
+  /// Geometric product
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  inline
+  vector_multi<Scalar_T,LO,HI>&
+  vector_multi<Scalar_T,LO,HI>::
+  operator*= (const multivector_t& rhs)
+  {
+    multivector_t result = *this * rhs;
+    return this->take_value(result);
+  }
+
+  /// Outer product
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  const vector_multi<Scalar_T,LO,HI>
+  operator^ (const vector_multi<Scalar_T,LO,HI>& lhs, const vector_multi<Scalar_T,LO,HI>& rhs)
+  {
+    typedef vector_multi<Scalar_T,LO,HI> multivector_t;
+    typedef typename multivector_t::index_set_t index_set_t;
+    typedef typename multivector_t::array_index_t array_index_t;
+
+    // Operate only within a common frame
+    multivector_t lhs_reframed;
+    multivector_t rhs_reframed;
+    const index_set_t our_frame = reframe(lhs, rhs, lhs_reframed, rhs_reframed);
+    const multivector_t& lhs_ref = (lhs.m_frame == our_frame)
+      ? lhs
+      : lhs_reframed;
+    const multivector_t& rhs_ref = (rhs.m_frame == our_frame)
+      ? rhs
+      : rhs_reframed;
+
+    const set_value_t neg_mask = (set_value_t(1) << our_frame.count_neg()) - 1;
+    const array_index_t dim = lhs_ref.m_array.size();
+    multivector_t result = multivector_t(Scalar_T(0), our_frame);
+    for (array_index_t
+        lhs_stv = 0;
+        lhs_stv != dim;
+        ++lhs_stv)
+    {
+      const Scalar_T lhs_val = lhs_ref.m_array[lhs_stv];
+      if (lhs_val == Scalar_T(0))
+        continue;
+      const set_value_t mask = folded_mult_mask(lhs_stv, neg_mask);
+      // Enumerate the subsets of the complement of lhs_stv
+      // Reference: [JA], 1.25
+      const set_value_t comp = (dim-1) & ~lhs_stv;
+      set_value_t rhs_stv = 0;
+      do
+      {
+        const Scalar_T& rhs_val = rhs_ref.m_array[rhs_stv];
+        if (bit_parity(rhs_stv & mask))
+          result.m_array[lhs_stv | rhs_stv] -= lhs_val * rhs_val;
+        else
+          result.m_array[lhs_stv | rhs_stv] += lhs_val * rhs_val;
+        rhs_stv = (rhs_stv - comp) & comp;
+      } while (rhs_stv != 0);
+    }
+    return result;
+  }
+
+  /// Outer product
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  inline
+  vector_multi<Scalar_T,LO,HI>&
+  vector_multi<Scalar_T,LO,HI>::
+  operator^= (const multivector_t& rhs)
+  {
+    multivector_t result = *this ^ rhs;
+    return this->take_value(result);
+  }
+
+  /// Inner product
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  const vector_multi<Scalar_T,LO,HI>
+  operator& (const vector_multi<Scalar_T,LO,HI>& lhs, const vector_multi<Scalar_T,LO,HI>& rhs)
+  {
+    typedef vector_multi<Scalar_T,LO,HI> multivector_t;
+    typedef typename multivector_t::index_set_t index_set_t;
+    typedef typename multivector_t::array_index_t array_index_t;
+
+    // Operate only within a common frame
+    multivector_t lhs_reframed;
+    multivector_t rhs_reframed;
+    const index_set_t our_frame = reframe(lhs, rhs, lhs_reframed, rhs_reframed);
+    const multivector_t& lhs_ref = (lhs.m_frame == our_frame)
+      ? lhs
+      : lhs_reframed;
+    const multivector_t& rhs_ref = (rhs.m_frame == our_frame)
+      ? rhs
+      : rhs_reframed;
+
+    // The terms of lhs and rhs contribute only if both are non-scalar,
+    // and one index set contains the other.
+    const set_value_t neg_mask = (set_value_t(1) << our_frame.count_neg()) - 1;
+    const array_index_t dim = lhs_ref.m_array.size();
+    multivector_t result = multivector_t(Scalar_T(0), our_frame);
+    for (array_index_t
+        lhs_stv = 1;
+        lhs_stv < dim;
+        ++lhs_stv)
+    {
+      const Scalar_T lhs_val = lhs_ref.m_array[lhs_stv];
+      if (lhs_val == Scalar_T(0))
+        continue;
+      const set_value_t mask = folded_mult_mask(lhs_stv, neg_mask);
+      // Enumerate the non-empty subsets of lhs_stv, then its proper supersets
+      // Reference: [JA], 1.25
+      set_value_t rhs_stv = lhs_stv;
+      do
+      {
+        const Scalar_T& crd = lhs_val * rhs_ref.m_array[rhs_stv];
+        if (bit_parity(rhs_stv & mask))
+          result.m_array[lhs_stv ^ rhs_stv] -= crd;
+        else
+          result.m_array[lhs_stv ^ rhs_stv] += crd;
+        rhs_stv = (rhs_stv - 1) & lhs_stv;
+      } while (rhs_stv != 0);
+      const set_value_t comp = (dim-1) & ~lhs_stv;
+      for (set_value_t
+          sub_stv = comp & -comp;
+          sub_stv != 0;
+          sub_stv = (sub_stv - comp) & comp)
+      {
+        const set_value_t rhs_stv = lhs_stv | sub_stv;
+        const Scalar_T& crd = lhs_val * rhs_ref.m_array[rhs_stv];
+        if (bit_parity(rhs_stv & mask))
+          result.m_array[sub_stv] -= crd;
+        else
+          result.m_array[sub_stv] += crd;
+      }
+    }
+    return result;
+  }
+
+  /// Inner product
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  inline
+  vector_multi<Scalar_T,LO,HI>&
+  vector_multi<Scalar_T,LO,HI>::
+  operator&= (const multivector_t& rhs)
+  {
+    multivector_t result = *this & rhs;
+    return this->take_value(result);
+  }
+
+  /// Left contraction
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  const vector_multi<Scalar_T,LO,HI>
+  operator% (const vector_multi<Scalar_T,LO,HI>& lhs, const vector_multi<Scalar_T,LO,HI>& rhs)
+  {
+    // Reference: Leo Dorst, "Honing geometric algebra for its use in the computer sciences",
+    // in Geometric Computing with Clifford Algebras, ed. G. Sommer,
+    // Springer 2001, Chapter 6, pp. 127-152.
+    // http://staff.science.uva.nl/~leo/clifford/index.html
+
+    typedef vector_multi<Scalar_T,LO,HI> multivector_t;
+    typedef typename multivector_t::index_set_t index_set_t;
+    typedef typename multivector_t::array_index_t array_index_t;
+
+    // Operate only within a common frame
+    multivector_t lhs_reframed;
+    multivector_t rhs_reframed;
+    const index_set_t our_frame = reframe(lhs, rhs, lhs_reframed, rhs_reframed);
+    const multivector_t& lhs_ref = (lhs.m_frame == our_frame)
+      ? lhs
+      : lhs_reframed;
+    const multivector_t& rhs_ref = (rhs.m_frame == our_frame)
+      ? rhs
+      : rhs_reframed;
+
+    const set_value_t neg_mask = (set_value_t(1) << our_frame.count_neg()) - 1;
+    const array_index_t dim = lhs_ref.m_array.size();
+    multivector_t result = multivector_t(Scalar_T(0), our_frame);
+    for (array_index_t
+        lhs_stv = 0;
+        lhs_stv != dim;
+        ++lhs_stv)
+    {
+      const Scalar_T lhs_val = lhs_ref.m_array[lhs_stv];
+      if (lhs_val == Scalar_T(0))
+        continue;
+      const set_value_t mask = folded_mult_mask(lhs_stv, neg_mask);
+      // Enumerate the supersets of lhs_stv, as subsets of its complement
+      // Reference: [JA], 1.25
+      const set_value_t comp = (dim-1) & ~lhs_stv;
+      set_value_t sub_stv = 0;
+      do
+      {
+        const set_value_t rhs_stv = lhs_stv | sub_stv;
+        const Scalar_T& crd = lhs_val * rhs_ref.m_array[rhs_stv];
+        if (bit_parity(rhs_stv & mask))
+          result.m_array[sub_stv] -= crd;
+        else
+          result.m_array[sub_stv] += crd;
+        sub_stv = (sub_stv - comp) & comp;
+      } while (sub_stv != 0);
+    }
+    return result;
+  }
+
+  /// Left contraction
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  inline
+  vector_multi<Scalar_T,LO,HI>&
+  vector_multi<Scalar_T,LO,HI>::
+  operator%= (const multivector_t& rhs)
+  {
+    multivector_t result = *this % rhs;
+    return this->take_value(result);
+  }
+
+  /// Hestenes scalar product
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  Scalar_T
+  star(const vector_multi<Scalar_T,LO,HI>& lhs, const vector_multi<Scalar_T,LO,HI>& rhs)
+  {
+    typedef vector_multi<Scalar_T,LO,HI> multivector_t;
+    typedef typename multivector_t::index_set_t index_set_t;
+    typedef typename multivector_t::array_index_t array_index_t;
+
+    // Operate only within a common frame
+    multivector_t lhs_reframed;
+    multivector_t rhs_reframed;
+    const index_set_t our_frame = reframe(lhs, rhs, lhs_reframed, rhs_reframed);
+    const multivector_t& lhs_ref = (lhs.m_frame == our_frame)
+      ? lhs
+      : lhs_reframed;
+    const multivector_t& rhs_ref = (rhs.m_frame == our_frame)
+      ? rhs
+      : rhs_reframed;
+
+    const set_value_t neg_mask = (set_value_t(1) << our_frame.count_neg()) - 1;
+    const array_index_t dim = lhs_ref.m_array.size();
+    Scalar_T result = Scalar_T(0);
+    for (array_index_t
+        stv = 0;
+        stv != dim;
+        ++stv)
+    {
+      const Scalar_T& crd = lhs_ref.m_array[stv] * rhs_ref.m_array[stv];
+      if (crd != Scalar_T(0))
+        result += folded_sign_of_square(stv, neg_mask) * crd;
+    }
+    return result;
+  }
+
+  /// Quotient of multivector and scalar
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  vector_multi<Scalar_T,LO,HI>&
+  vector_multi<Scalar_T,LO,HI>::
+  operator/= (const Scalar_T& scr)
+  { // Divide coordinates of all terms by scr
+    typedef numeric_traits<Scalar_T> traits_t;
+
+    if (traits_t::isNaN(scr))
+      return *this = traits_t::NaN();
+    if (traits_t::isInf(scr))
+    {
+      if (this->isnan())
+        *this = traits_t::NaN();
+      else
+        this->m_array.assign(this->m_array.size(), Scalar_T(0));
+    }
+    else
+    {
+      const array_index_t dim = this->m_array.size();
+      Scalar_T* this_crd = &(this->m_array[0]);
+      for (array_index_t
+          stv = 0;
+          stv != dim;
+          ++stv)
+        this_crd[stv] /= scr;
+    }
+    return *this;
+  }
+
+  /// Geometric quotient
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  const vector_multi<Scalar_T,LO,HI>
+  operator/ (const vector_multi<Scalar_T,LO,HI>& lhs, const vector_multi<Scalar_T,LO,HI>& rhs)
+  {
+    typedef vector_multi<Scalar_T,LO,HI> multivector_t;
+    typedef numeric_traits<Scalar_T> traits_t;
+    typedef typename multivector_t::index_set_t index_set_t;
+    typedef typename multivector_t::framed_multi_t framed_multi_t;
+    typedef typename multivector_t::matrix_multi_t matrix_multi_t;
+
+    if (rhs == Scalar_T(0))
+      return traits_t::NaN();
+
+    const index_set_t our_frame = lhs.m_frame | rhs.m_frame;
+    return matrix_multi_t(framed_multi_t(lhs), our_frame, true) /
+           matrix_multi_t(framed_multi_t(rhs), our_frame, true);
+  }
+
+  /// Geometric quotient
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  inline
+  vector_multi<Scalar_T,LO,HI>&
+  vector_multi<Scalar_T,LO,HI>::
+  operator/= (const multivector_t& rhs)
+  {
+    multivector_t result = *this / rhs;
+    return this->take_value(result);
+  }
+
+  /// Transformation via twisted adjoint action
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  inline
+  const vector_multi<Scalar_T,LO,HI>
+  operator| (const vector_multi<Scalar_T,LO,HI>& lhs, const vector_multi<Scalar_T,LO,HI>& rhs)
+  { return rhs * lhs / rhs.involute(); }
+
+  /// Transformation via twisted adjoint action
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  inline
+  vector_multi<Scalar_T,LO,HI>&
+  vector_multi<Scalar_T,LO,HI>::
+  operator|= (const multivector_t& rhs)
+  {
+    multivector_t result = rhs * *this / rhs.involute();
+    return this->take_value(result);
+  }
+
+  /// Clifford multiplicative inverse
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  inline
+  const vector_multi<Scalar_T,LO,HI>
+  vector_multi<Scalar_T,LO,HI>::
+  inv() const
+  { return multivector_t(Scalar_T(1), this->m_frame) / *this; }
+
+  /// Integer power of multivector: *this to the m
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  inline
+  const vector_multi<Scalar_T,LO,HI>
+  vector_multi<Scalar_T,LO,HI>::
+  pow(int m) const
+  { return glucat::pow(*this, m); }
+
+  /// Outer product power of multivector
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  const vector_multi<Scalar_T,LO,HI>
+  vector_multi<Scalar_T,LO,HI>::
+  outer_pow(int m) const
+  {
+    if (m < 0)
+      throw error_t("outer_pow(m): negative exponent");
+    multivector_t result = multivector_t(Scalar_T(1), this->m_frame);
+    multivector_t a = *this;
+    for (;
+        m != 0;
+        m >>= 1, a ^= a)
+      if (m & 1)
+        result ^= a;
+    return result;
+  }
+
+  /// Frame of multivector: the frame of the coordinate array
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  inline
+  const index_set<LO,HI>
+  vector_multi<Scalar_T,LO,HI>::
+  frame() const
+  { return this->m_frame; }
+
+  /// Grade of multivector: maximum of the grades of each term
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  index_t
+  vector_multi<Scalar_T,LO,HI>::
+  grade() const
+  {
+    index_t result = 0;
+    const array_index_t dim = this->m_array.size();
+    for (array_index_t
+        stv = 1;
+        stv != dim;
+        ++stv)
+      if (this->m_array[stv] != Scalar_T(0))
+        result = std::max( result, bit_count(stv) );
+    return result;
+  }
+
+  /// Subscripting: map from index set to scalar coordinate
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  inline
+  Scalar_T
+  vector_multi<Scalar_T,LO,HI>::
+  operator[] (const index_set_t ist) const
+  {
+    if ( (ist | this->m_frame) == this->m_frame)
+      return this->m_array[ist.value_of_fold(this->m_frame)];
+    else
+      return Scalar_T(0);
+  }
+
+  /// Grading: part where each term is a grade-vector
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  const vector_multi<Scalar_T,LO,HI>
+  vector_multi<Scalar_T,LO,HI>::
+  operator() (index_t grade) const
+  {
+    if ((grade < 0) || (grade > HI-LO))
+      return Scalar_T(0);
+    multivector_t result = multivector_t(Scalar_T(0), this->m_frame);
+    const array_index_t dim = this->m_array.size();
+    for (array_index_t
+        stv = 0;
+        stv != dim;
+        ++stv)
+      if (bit_count(stv) == grade)
+        result.m_array[stv] = this->m_array[stv];
+    return result;
+  }
+
+  /// Scalar part
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  inline
+  Scalar_T
+  vector_multi<Scalar_T,LO,HI>::
+  scalar() const
+  { return this->m_array[0]; }
+
+  /// Pure part
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  inline
+  const vector_multi<Scalar_T,LO,HI>
+  vector_multi<Scalar_T,LO,HI>::
+  pure() const
+  {
+    multivector_t result = *this;
+    result.m_array[0] = Scalar_T(0);
+    return result;
+  }
+
+  /// Even part, sum of the even grade terms
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  const vector_multi<Scalar_T,LO,HI>
+  vector_multi<Scalar_T,LO,HI>::
+  even() const
+  {
+    multivector_t result = *this;
+    const array_index_t dim = this->m_array.size();
+    for (array_index_t
+        stv = 0;
+        stv != dim;
+        ++stv)
+      if (bit_parity(stv))
+        result.m_array[stv] = Scalar_T(0);
+    return result;
+  }
+
+  /// Odd part, sum of the odd grade terms
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  const vector_multi<Scalar_T,LO,HI>
+  vector_multi<Scalar_T,LO,HI>::
+  odd() const
+  {
+    multivector_t result = *this;
+    const array_index_t dim = this->m_array.size();
+    for (array_index_t
+        stv = 0;
+        stv != dim;
+        ++stv)
+      if (!bit_parity(stv))
+        result.m_array[stv] = Scalar_T(0);
+    return result;
+  }
+
+  /// Vector part of multivector, as a vector_t
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  const typename vector_multi<Scalar_T,LO,HI>::vector_t
+  vector_multi<Scalar_T,LO,HI>::
+  vector_part() const
+  { return this->vector_part(this->frame(), true); }
+
+  /// Vector part of multivector, as a vector_t
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  const typename vector_multi<Scalar_T,LO,HI>::vector_t
+  vector_multi<Scalar_T,LO,HI>::
+  vector_part(const index_set_t frm, const bool prechecked) const
+  {
+    if (!prechecked && (this->frame() | frm) != frm)
+      throw error_t("vector_part(frm): value is outside of requested frame");
+    // If we need to enlarge the frame we may as well use a framed_multi_t
+    if (this->frame() != frm)
+      return framed_multi_t(*this).vector_part(frm, true);
+
+    const index_t frm_count = frm.count();
+    vector_t result;
+    result.reserve(frm_count);
+    for (index_t
+        k = 0;
+        k != frm_count;
+        ++k)
+      result.push_back(this->m_array[array_index_t(1) << k]);
+    return result;
+  }
+
+  /// Main involution, each {i} is replaced by -{i} in each term
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  const vector_multi<Scalar_T,LO,HI>
+  vector_multi<Scalar_T,LO,HI>::
+  involute() const
+  {
+    multivector_t result = *this;
+    const array_index_t dim = this->m_array.size();
+    for (array_index_t
+        stv = 0;
+        stv != dim;
+        ++stv)
+      // for a k-vector u, involute(u) == (-1)^k * u
+      if (bit_parity(stv))
+        result.m_array[stv] = -result.m_array[stv];
+    return result;
+  }
+
+  /// Reversion, order of {i} is reversed in each term
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  const vector_multi<Scalar_T,LO,HI>
+  vector_multi<Scalar_T,LO,HI>::
+  reverse() const
+  {
+    multivector_t result = *this;
+    const array_index_t dim = this->m_array.size();
+    for (array_index_t
+        stv = 0;
+        stv != dim;
+        ++stv)
+      // For a k-vector u, reverse(u) = { -u, k == 2,3 (mod 4)
+      //                                {  u, k == 0,1 (mod 4)
+      if ((bit_count(stv) % 4) > 1)
+        result.m_array[stv] = -result.m_array[stv];
+    return result;
+  }
+
+  /// Conjugation, conj == reverse o involute == involute o reverse
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  const vector_multi<Scalar_T,LO,HI>
+  vector_multi<Scalar_T,LO,HI>::
+  conj() const
+  {
+    multivector_t result = *this;
+    const array_index_t dim = this->m_array.size();
+    for (array_index_t
+        stv = 0;
+        stv != dim;
+        ++stv)
+      // For a k-vector u, conj(u) = { -u, k == 1,2 (mod 4)
+      //                             {  u, k == 0,3 (mod 4)
+      switch (bit_count(stv) % 4)
+      {
+      case 1:
+      case 2:
+        result.m_array[stv] = -result.m_array[stv];
+        break;
+      default:
+        break;
+      }
+    return result;
+  }
+
+  /// Quadratic form := scalar part of rev(x)*x
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  Scalar_T
+  vector_multi<Scalar_T,LO,HI>::
+  quad() const
+  {
+    // scalar(conj(x)*x) = 2*quad(even(x)) - quad(x)
+    // ref: old clical: quadfunction(p:pter):pterm in file compmod.pas
+    const set_value_t neg_mask = (set_value_t(1) << this->m_frame.count_neg()) - 1;
+    Scalar_T result = Scalar_T(0);
+    const array_index_t dim = this->m_array.size();
+    for (array_index_t
+        stv = 0;
+        stv != dim;
+        ++stv)
+    {
+      const Scalar_T& crd = this->m_array[stv];
+      if (bit_parity(stv & neg_mask))
+        result -= crd * crd;
+      else
+        result += crd * crd;
+    }
+    return result;
+  }
+
+  /// Norm squared := sum of norm squared of coordinates
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  Scalar_T
+  vector_multi<Scalar_T,LO,HI>::
+  norm() const
+  {
+    typedef numeric_traits<Scalar_T> traits_t;
+
+    Scalar_T result = Scalar_T(0);
+    const array_index_t dim = this->m_array.size();
+    for (array_index_t
+        stv = 0;
+        stv != dim;
+        ++stv)
+    {
+      const Scalar_T abs_crd = traits_t::abs(this->m_array[stv]);
+      result += abs_crd * abs_crd;
+    }
+    return result;
+  }
+
+  /// Maximum of absolute values of components of multivector: multivector infinity norm
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  Scalar_T
+  vector_multi<Scalar_T,LO,HI>::
+  max_abs() const
+  {
+    typedef numeric_traits<Scalar_T> traits_t;
+
+    Scalar_T result = Scalar_T(0);
+    const array_index_t dim = this->m_array.size();
+    for (array_index_t
+        stv = 0;
+        stv != dim;
+        ++stv)
+    {
+      const Scalar_T abs_crd = traits_t::abs(this->m_array[stv]);
+      if (abs_crd > result)
+        result = abs_crd;
+    }
+    return result;
+  }
+
+  /// Random multivector within a frame
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  const vector_multi<Scalar_T,LO,HI>
+  vector_multi<Scalar_T,LO,HI>::
+  random(const index_set<LO,HI> frm, Scalar_T fill)
+  { return multivector_t(framed_multi_t::random(frm, fill), frm, true); }
+
+  /// Write multivector to output
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  inline
+  void
+  vector_multi<Scalar_T,LO,HI>::
+  write(const std::string& msg) const
+  { framed_multi_t(*this).write(msg); }
+
+  /// Write multivector to file
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  inline
+  void
+  vector_multi<Scalar_T,LO,HI>::
+  write(std::ofstream& ofile, const std::string& msg) const
+  {
+    if (!ofile)
+      throw error_t("write(ofile,msg): cannot write to output file");
+    framed_multi_t(*this).write(ofile, msg);
+  }
+
+  /// Write multivector to output
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  inline
+  std::ostream&
+  operator<< (std::ostream& os, const vector_multi<Scalar_T,LO,HI>& val)
+  {
+    os << typename vector_multi<Scalar_T,LO,HI>::framed_multi_t(val);
+    return os;
+  }
+
+  /// Read multivector from input
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  inline
+  std::istream&
+  operator>> (std::istream& s, vector_multi<Scalar_T,LO,HI>& val)
+  { // Input looks like 1.0-2.0{1,2}+3.2{3,4}
+    framed_multi<Scalar_T,LO,HI> local;
+    s >> local;
+    // If s.bad() then we have a corrupt input
+    // otherwise we are fine and can copy the resulting vector_multi
+    if (!s.bad())
+      val = local;
+    return s;
+  }
+
+  /// Number of terms
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  unsigned long
+  vector_multi<Scalar_T,LO,HI>::
+  nbr_terms () const
+  {
+    unsigned long result = 0;
+    const array_index_t dim = this->m_array.size();
+    for (array_index_t
+        stv = 0;
+        stv != dim;
+        ++stv)
+      if (this->m_array[stv] != Scalar_T(0))
+        ++result;
+    return result;
+  }
+
+  /// Check if a multivector contains any IEEE NaN values
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  bool
+  vector_multi<Scalar_T,LO,HI>::
+  isnan() const
+  {
+    typedef numeric_traits<Scalar_T> traits_t;
+
+    if (std::numeric_limits<Scalar_T>::has_quiet_NaN)
+    {
+      const array_index_t dim = this->m_array.size();
+      for (array_index_t
+          stv = 0;
+          stv != dim;
+          ++stv)
+        if (traits_t::isNaN(this->m_array[stv]))
+          return true;
+    }
+    return false;
+  }
+
+  /// Remove all terms with relative size smaller than limit
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  const vector_multi<Scalar_T,LO,HI>
+  vector_multi<Scalar_T,LO,HI>::
+  truncated(const Scalar_T& limit) const
+  {
+    typedef numeric_traits<Scalar_T> traits_t;
+
+    const Scalar_T abs_limit = traits_t::abs(limit);
+    if (this->isnan())
+      return *this;
+    const Scalar_T top = this->max_abs();
+    multivector_t result = multivector_t(Scalar_T(0), this->m_frame);
+    if (top != Scalar_T(0))
+    {
+      const array_index_t dim = this->m_array.size();
+      for (array_index_t
+          stv = 0;
+          stv != dim;
+          ++stv)
+        if (traits_t::abs(this->m_array[stv] / top) > abs_limit)
+          result.m_array[stv] = this->m_array[stv];
+    }
+    return result;
+  }
+
+  /// Add a term, if non-zero
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  vector_multi<Scalar_T,LO,HI>&
+  vector_multi<Scalar_T,LO,HI>::
+  operator+= (const term_t& term)
+  {
+    if (term.second != Scalar_T(0))
+    {
+      const index_set_t our_frame = this->m_frame | term.first;
+      if (our_frame != this->m_frame)
+        *this = multivector_t(*this, our_frame, true);
+      this->m_array[term.first.value_of_fold(our_frame)] += term.second;
+    }
+    return *this;
+  }
+
+  /// Square root of multivector with specified complexifier
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  const vector_multi<Scalar_T,LO,HI>
+  sqrt(const vector_multi<Scalar_T,LO,HI>& val, const vector_multi<Scalar_T,LO,HI>& i, bool prechecked)
+  {
+    typedef numeric_traits<Scalar_T> traits_t;
+    if (val.isnan())
+      return traits_t::NaN();
+
+    check_complex(val, i, prechecked);
+
+    const Scalar_T realval = val.scalar();
+    if (val == realval)
+    {
+      if (realval < Scalar_T(0))
+        return i * traits_t::sqrt(-realval);
+      else
+        return traits_t::sqrt(realval);
+    }
+    typedef typename vector_multi<Scalar_T,LO,HI>::framed_multi_t framed_multi_t;
+    typedef typename vector_multi<Scalar_T,LO,HI>::matrix_multi_t matrix_multi_t;
+    return sqrt(matrix_multi_t(framed_multi_t(val), val.frame(), true),
+                matrix_multi_t(framed_multi_t(i),   i.frame(),   true), prechecked);
+  }
+
+  /// Exponential of multivector
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  const vector_multi<Scalar_T,LO,HI>
+  exp(const vector_multi<Scalar_T,LO,HI>& val)
+  {
+    typedef numeric_traits<Scalar_T> traits_t;
+    if (val.isnan())
+      return traits_t::NaN();
+
+    const Scalar_T s = scalar(val);
+    if (val == s)
+      return traits_t::exp(s);
+
+    if (val.frame().count() < Tune_P::dense_mult_matrix_threshold)
+    {
+      switch (Tune_P::function_precision)
+      {
+      case precision_demoted:
+        {
+          typedef typename traits_t::demoted::type demoted_scalar_t;
+          typedef vector_multi<demoted_scalar_t,LO,HI> demoted_multivector_t;
+
+          const demoted_multivector_t& demoted_val = demoted_multivector_t(val);
+          return clifford_exp(demoted_val);
+        }
+        break;
+      case precision_promoted:
+        {
+          typedef typename traits_t::promoted::type promoted_scalar_t;
+          typedef vector_multi<promoted_scalar_t,LO,HI> promoted_multivector_t;
+
+          const promoted_multivector_t& promoted_val = promoted_multivector_t(val);
+          return clifford_exp(promoted_val);
+        }
+        break;
+      default:
+        return clifford_exp(val);
+      }
+    }
+    else
+    {
+      typedef typename vector_multi<Scalar_T,LO,HI>::framed_multi_t framed_multi_t;
+      typedef typename vector_multi<Scalar_T,LO,HI>::matrix_multi_t matrix_multi_t;
+      return exp(matrix_multi_t(framed_multi_t(val), val.frame(), true));
+    }
+  }
+
+  /// Natural logarithm of multivector with specified complexifier
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  const vector_multi<Scalar_T,LO,HI>
+  log(const vector_multi<Scalar_T,LO,HI>& val, const vector_multi<Scalar_T,LO,HI>& i, bool prechecked)
+  {
+    typedef numeric_traits<Scalar_T> traits_t;
+    if (val == Scalar_T(0) || val.isnan())
+      return traits_t::NaN();
+
+    check_complex(val, i, prechecked);
+
+    const Scalar_T realval = val.scalar();
+    if (val == realval)
+    {
+      if (realval < Scalar_T(0))
+        return i * traits_t::pi() + traits_t::log(-realval);
+      else
+        return traits_t::log(realval);
+    }
+    typedef typename vector_multi<Scalar_T,LO,HI>::framed_multi_t framed_multi_t;
+    typedef typename vector_multi<Scalar_T,LO,HI>::matrix_multi_t matrix_multi_t;
+    return log(matrix_multi_t(framed_multi_t(val), val.frame(), true),
+               matrix_multi_t(framed_multi_t(i),   i.frame(),   true), prechecked);
+  }
+}
+#endif  // _GLUCAT_VECTOR_MULTI_IMP_H
@@ -0,0 +1,59 @@
+/***************************************************************************
+    GluCat : Generic library of universal Clifford algebra templates
+    batch_products.cpp : batch_product timing test driver
+                             -------------------
+    begin                : Sat 2026-10-17
+    copyright            : (C) 2012-2016 by Paul C. Leopardi
+ ***************************************************************************
+
+    This library is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published
+    by the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with this library.  If not, see <http://www.gnu.org/licenses/>.
+
+ ***************************************************************************
+ This library is based on a prototype written by Arvind Raja and was
+ licensed under the LGPL with permission of the author. See Arvind Raja,
+ "Object-oriented implementations of Clifford algebras in C++: a prototype",
+ in Ablamowicz, Lounesto and Parra (eds.)
+ "Clifford algebras with numeric and symbolic computations", Birkhauser, 1996.
+ ***************************************************************************
+     See also Arvind Raja's original header comments in glucat.h
+ ***************************************************************************/
+
+#include "products/batch_products.h"
+
+int batch_products(const int n)
+{
+  using namespace glucat_batch_test;
+  if (n > max_n)
+  {
+    cout << "Value " << n << " is too big." << endl;
+    cout << "Maximum value allowed is " << max_n << "." << endl;
+    return 1;
+  }
+  batch_test(n);
+  return 0;
+}
+
+using namespace glucat;
+
+int main(int argc, char ** argv)
+{
+  using namespace std;
+  for (argc--, argv++; argc != 0; argc--, argv++)
+  {
+    int n = 0;
+    sscanf(*argv, "%d", &n);
+    try_catch(batch_products, n);
+  }
+  return 0;
+}
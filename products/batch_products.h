@@ -0,0 +1,157 @@
+#ifndef GLUCAT_TEST_BATCH_PRODUCTS_H
+#define GLUCAT_TEST_BATCH_PRODUCTS_H
+/***************************************************************************
+    GluCat : Generic library of universal Clifford algebra templates
+    batch_products.h : batch_product speed test
+                             -------------------
+    begin                : Sat 2026-10-17
+    copyright            : (C) 2012-2016 by Paul C. Leopardi
+ ***************************************************************************
+
+    This library is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published
+    by the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with this library.  If not, see <http://www.gnu.org/licenses/>.
+
+ ***************************************************************************
+ This library is based on a prototype written by Arvind Raja and was
+ licensed under the LGPL with permission of the author. See Arvind Raja,
+ "Object-oriented implementations of Clifford algebras in C++: a prototype",
+ in Ablamowicz, Lounesto and Parra (eds.)
+ "Clifford algebras with numeric and symbolic computations", Birkhauser, 1996.
+ ***************************************************************************
+     See also Arvind Raja's original header comments in glucat.h
+ ***************************************************************************/
+
+#define _GLUCAT_TEST_REPEAT
+#include "glucat/glucat.h"
+#include "test/tuning.h"
+#include "glucat/glucat_imp.h"
+#include "test/timing.h"
+#include "test/try_catch.h"
+#include <stdio.h>
+#include <iomanip>
+#include <limits>
+#include <vector>
+
+namespace glucat_batch_test
+{
+  using namespace glucat;
+  using namespace glucat::timing;
+  using namespace std;
+
+  typedef framed_multi<double>                        multivector_t;
+  typedef multivector_t::index_set_t                  index_set_t;
+  typedef batch_product<double>                       batch_product_t;
+
+  /// The table of signs for a frame of n indices has 4^n entries
+  const index_t max_n = 8;
+
+  /// Number of pairs of multivectors in each batch
+  const int batch_size = 1 << 14;
+
+  inline
+  void
+  print_times(const index_set_t& frame,
+              const double pair_cpu_time,
+              const double batch_cpu_time,
+              const int nbr_mismatches)
+  {
+    const int index_width = 2;
+    cout << "Cl(" << setw(index_width) <<  max_pos(frame) << ","
+                  << setw(index_width) << -min_neg(frame) << ")"
+         << " CPU = ";
+    const ios::fmtflags& old_flags = cout.flags();
+    const streamsize width = 12;
+    const streamsize old_prec = cout.precision();
+    const streamsize new_prec = 3;
+    cout.setf(ios_base::fixed);
+    cout.setf(ios_base::showpoint);
+    cout << setprecision(new_prec)
+         << setw(width) << pair_cpu_time  << " ms (*) "
+         << setw(width) << batch_cpu_time << " (batch) "
+         << setw(width) << pair_cpu_time / batch_cpu_time << " (ratio) "
+         << setprecision(old_prec)
+         << nbr_mismatches << " (mismatches)"
+         << endl;
+    cout.flags(old_flags);
+  }
+
+  /// Time batch_size products using operator* for each pair and using batch_product
+  static
+  void
+  time_batch(const index_set_t frame)
+  {
+    const batch_product_t table(frame);
+    const size_t dim = table.dim();
+
+    vector<multivector_t> lhs(batch_size);
+    vector<multivector_t> rhs(batch_size);
+    vector<double> lhs_coords(dim * batch_size);
+    vector<double> rhs_coords(dim * batch_size);
+    for (int
+        i = 0;
+        i != batch_size;
+        ++i)
+    {
+      lhs[i] = multivector_t::random(frame);
+      rhs[i] = multivector_t::random(frame);
+      table.pack(lhs[i], &lhs_coords[0], batch_size, i);
+      table.pack(rhs[i], &rhs_coords[0], batch_size, i);
+    }
+
+    vector<multivector_t> pair_result(batch_size);
+    clock_t cpu_time = clock();
+      for (int
+          i = 0;
+          i != batch_size;
+          ++i)
+        pair_result[i] = lhs[i] * rhs[i];
+    const double pair_cpu_time = elapsed(cpu_time);
+
+    vector<double> batch_coords(dim * batch_size);
+    cpu_time = clock();
+      table.multiply(&lhs_coords[0], &rhs_coords[0], &batch_coords[0], batch_size);
+    const double batch_cpu_time = elapsed(cpu_time);
+
+    const double tol = numeric_limits<double>::epsilon() * double(dim);
+    int nbr_mismatches = 0;
+    for (int
+        i = 0;
+        i != batch_size;
+        ++i)
+    {
+      const multivector_t batch_result = table.unpack(&batch_coords[0], batch_size, i);
+      if ((batch_result - pair_result[i]).max_abs() > tol * (lhs[i].max_abs() * rhs[i].max_abs()))
+        ++nbr_mismatches;
+    }
+    print_times(frame, pair_cpu_time, batch_cpu_time, nbr_mismatches);
+  }
+
+  static
+  void
+  batch_test(const index_t n)
+  {
+    cout << "Batch geometric product test:" << endl;
+    cout << "Pairs per batch: " << batch_size << endl;
+
+    index_set_t frame = index_set_t();
+    for (index_t i = 1; i != n+1; ++i)
+    {
+      frame |= index_set_t((i % 2) ? (i+1)/2 : -(i/2));
+      time_batch(frame);
+    }
+  }
+}
+
+int batch_products(const int n);
+
+#endif // GLUCAT_TEST_BATCH_PRODUCTS_H
@@ -0,0 +1,219 @@
+#ifndef GLUCAT_TEST_FIXED_PRODUCTS_H
+#define GLUCAT_TEST_FIXED_PRODUCTS_H
+/***************************************************************************
+    GluCat : Generic library of universal Clifford algebra templates
+    fixed_products.h : fixed_multi speed test
+                             -------------------
+    begin                : Sat 2026-10-17
+    copyright            : (C) 2012-2016 by Paul C. Leopardi
+ ***************************************************************************
+
+    This library is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published
+    by the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with this library.  If not, see <http://www.gnu.org/licenses/>.
+
+ ***************************************************************************
+ This library is based on a prototype written by Arvind Raja and was
+ licensed under the LGPL with permission of the author. See Arvind Raja,
+ "Object-oriented implementations of Clifford algebras in C++: a prototype",
+ in Ablamowicz, Lounesto and Parra (eds.)
+ "Clifford algebras with numeric and symbolic computations", Birkhauser, 1996.
+ ***************************************************************************
+     See also Arvind Raja's original header comments in glucat.h
+ ***************************************************************************/
+
+#define _GLUCAT_TEST_REPEAT
+#include "glucat/glucat.h"
+#include "test/tuning.h"
+#include "glucat/glucat_imp.h"
+#include "test/timing.h"
+#include "test/try_catch.h"
+#include <stdio.h>
+#include <iomanip>
+#include <limits>
+#include <vector>
+
+namespace glucat_fixed_test
+{
+  using namespace glucat;
+  using namespace glucat::timing;
+  using namespace std;
+
+  typedef framed_multi<double>                        multivector_t;
+  typedef multivector_t::index_set_t                  index_set_t;
+
+  /// fixed_multi<> is limited to frames of 6 indices
+  const index_t max_n = 6;
+
+  /// Number of pairs of multivectors multiplied for each product
+  const int nbr_pairs = 1 << 12;
+
+  inline
+  void
+  print_times(const index_set_t& frame,
+              const string& product_name,
+              const double framed_cpu_time,
+              const double fixed_cpu_time,
+              const int nbr_mismatches)
+  {
+    const int index_width = 2;
+    cout << "Cl(" << setw(index_width) <<  max_pos(frame) << ","
+                  << setw(index_width) << -min_neg(frame) << ")"
+         << " " << product_name << " CPU = ";
+    const ios::fmtflags& old_flags = cout.flags();
+    const streamsize width = 12;
+    const streamsize old_prec = cout.precision();
+    const streamsize new_prec = 3;
+    cout.setf(ios_base::fixed);
+    cout.setf(ios_base::showpoint);
+    cout << setprecision(new_prec)
+         << setw(width) << framed_cpu_time << " ms (framed) "
+         << setw(width) << fixed_cpu_time  << " (fixed) "
+         << setw(width) << framed_cpu_time / fixed_cpu_time << " (ratio) "
+         << setprecision(old_prec)
+         << nbr_mismatches << " (mismatches)"
+         << endl;
+    cout.flags(old_flags);
+  }
+
+  /// Time one product using framed_multi<> and using fixed_multi<>, and compare the results
+  template< typename Fixed_T, typename Product_T >
+  void
+  time_product(const string& product_name,
+               const vector<multivector_t>& lhs,
+               const vector<multivector_t>& rhs,
+               const Product_T& product)
+  {
+    const index_set_t frame = Fixed_T::frame();
+    vector<Fixed_T> fixed_lhs(nbr_pairs);
+    vector<Fixed_T> fixed_rhs(nbr_pairs);
+    for (int
+        i = 0;
+        i != nbr_pairs;
+        ++i)
+    {
+      fixed_lhs[i] = Fixed_T(lhs[i]);
+      fixed_rhs[i] = Fixed_T(rhs[i]);
+    }
+
+    vector<multivector_t> framed_result(nbr_pairs);
+    clock_t cpu_time = clock();
+      for (int
+          i = 0;
+          i != nbr_pairs;
+          ++i)
+        framed_result[i] = product(lhs[i], rhs[i]);
+    const double framed_cpu_time = elapsed(cpu_time);
+
+    vector<Fixed_T> fixed_result(nbr_pairs);
+    cpu_time = clock();
+      for (int
+          i = 0;
+          i != nbr_pairs;
+          ++i)
+        fixed_result[i] = product(fixed_lhs[i], fixed_rhs[i]);
+    const double fixed_cpu_time = elapsed(cpu_time);
+
+    const double tol = numeric_limits<double>::epsilon() * double(Fixed_T::dim);
+    int nbr_mismatches = 0;
+    for (int
+        i = 0;
+        i != nbr_pairs;
+        ++i)
+      if ((fixed_result[i].framed() - framed_result[i]).max_abs() > tol * (lhs[i].max_abs() * rhs[i].max_abs()))
+        ++nbr_mismatches;
+    print_times(frame, product_name, framed_cpu_time, fixed_cpu_time, nbr_mismatches);
+  }
+
+  struct geometric_product
+  {
+    template< typename Multivector_T >
+    const Multivector_T operator() (const Multivector_T& lhs, const Multivector_T& rhs) const
+    { return lhs * rhs; }
+  };
+
+  struct outer_product
+  {
+    template< typename Multivector_T >
+    const Multivector_T operator() (const Multivector_T& lhs, const Multivector_T& rhs) const
+    { return lhs ^ rhs; }
+  };
+
+  struct inner_product
+  {
+    template< typename Multivector_T >
+    const Multivector_T operator() (const Multivector_T& lhs, const Multivector_T& rhs) const
+    { return lhs & rhs; }
+  };
+
+  struct left_contraction
+  {
+    template< typename Multivector_T >
+    const Multivector_T operator() (const Multivector_T& lhs, const Multivector_T& rhs) const
+    { return lhs % rhs; }
+  };
+
+  /// Time each product within the frame of Cl(P,Q)
+  template< const index_t P, const index_t Q >
+  void
+  time_fixed()
+  {
+    typedef fixed_multi<double,P,Q> fixed_t;
+    const index_set_t frame = fixed_t::frame();
+    vector<multivector_t> lhs(nbr_pairs);
+    vector<multivector_t> rhs(nbr_pairs);
+    for (int
+        i = 0;
+        i != nbr_pairs;
+        ++i)
+    {
+      lhs[i] = multivector_t::random(frame);
+      rhs[i] = multivector_t::random(frame);
+    }
+    time_product<fixed_t>("*", lhs, rhs, geometric_product());
+    time_product<fixed_t>("^", lhs, rhs, outer_product());
+    time_product<fixed_t>("&", lhs, rhs, inner_product());
+    time_product<fixed_t>("%", lhs, rhs, left_contraction());
+  }
+
+  /// Time the products for frames of 1 to N indices, up to a frame of n indices
+  template< const index_t N >
+  struct fixed_test_upto
+  {
+    static void run(const index_t n)
+    {
+      fixed_test_upto<N-1>::run(n);
+      if (N <= n)
+        time_fixed<(N+1)/2, N/2>();
+    }
+  };
+
+  template< >
+  struct fixed_test_upto<0>
+  {
+    static void run(const index_t)
+    { }
+  };
+
+  static
+  void
+  fixed_test(const index_t n)
+  {
+    cout << "Fixed signature product test:" << endl;
+    cout << "Pairs per product: " << nbr_pairs << endl;
+    fixed_test_upto<max_n>::run(n);
+  }
+}
+
+int fixed_products(const int n);
+
+#endif // GLUCAT_TEST_FIXED_PRODUCTS_H
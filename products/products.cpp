@@ -45,10 +45,14 @@ int products(const int n)
   prod_test< framed_multi<float,-4,4> >(small_n, max_n);
   cout << endl << "matrix_multi<float,-4,4>" << endl;
   prod_test< matrix_multi<float,-4,4> >(small_n, max_n);
+  cout << endl << "vector_multi<float,-4,4>" << endl;
+  prod_test< vector_multi<float,-4,4> >(small_n, max_n);
   cout << endl << "framed_multi<double>" << endl;
   prod_test< framed_multi<double> >(n, max_n);
   cout << endl << "matrix_multi<double>" << endl;
   prod_test< matrix_multi<double> >(n, max_n);
+  cout << endl << "vector_multi<double>" << endl;
+  prod_test< vector_multi<double> >(n, max_n);
 
   return 0;
 }
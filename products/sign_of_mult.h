@@ -0,0 +1,200 @@
+#ifndef GLUCAT_TEST_SIGN_OF_MULT_H
+#define GLUCAT_TEST_SIGN_OF_MULT_H
+/***************************************************************************
+    GluCat : Generic library of universal Clifford algebra templates
+    sign_of_mult.h : sign_of_mult speed test
+                             -------------------
+    begin                : Sat 2026-10-17
+    copyright            : (C) 2012-2016 by Paul C. Leopardi
+ ***************************************************************************
+
+    This library is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published
+    by the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with this library.  If not, see <http://www.gnu.org/licenses/>.
+
+ ***************************************************************************
+ This library is based on a prototype written by Arvind Raja and was
+ licensed under the LGPL with permission of the author. See Arvind Raja,
+ "Object-oriented implementations of Clifford algebras in C++: a prototype",
+ in Ablamowicz, Lounesto and Parra (eds.)
+ "Clifford algebras with numeric and symbolic computations", Birkhauser, 1996.
+ ***************************************************************************
+     See also Arvind Raja's original header comments in glucat.h
+ ***************************************************************************/
+
+#define _GLUCAT_TEST_REPEAT
+#include "glucat/glucat.h"
+#include "test/tuning.h"
+#include "glucat/glucat_imp.h"
+#include "test/timing.h"
+#include "test/try_catch.h"
+#include <stdio.h>
+#include <iomanip>
+#include <vector>
+
+namespace glucat_sign_test
+{
+  using namespace glucat;
+  using namespace glucat::timing;
+  using namespace std;
+
+  typedef index_set<DEFAULT_LO,DEFAULT_HI> index_set_t;
+
+  const index_t max_n = DEFAULT_HI - DEFAULT_LO;
+
+  /// Number of index sets used for each frame
+  const int nbr_sets = 1 << 10;
+
+  /// Sign of geometric product of two basis elements, using a loop over each bit
+  inline
+  static
+  int
+  loop_sign_of_mult(const set_value_t uthis, const set_value_t urhs)
+  {
+    const index_t LO = index_set_t::v_lo;
+    const index_t nbits = index_set_t::v_hi - LO;
+    set_value_t negative = 0;
+    set_value_t h = 0;
+    index_t j;
+    for (j = 0;
+        j < -LO;
+        ++j)
+    {
+      h ^= urhs >> j;
+      negative ^= h & (uthis >> j);
+    }
+    for (j = -LO;
+        j < nbits;
+        ++j)
+    {
+      negative ^= h & (uthis >> j);
+      h ^= urhs >> j;
+    }
+    return 1 - int((negative & 1) << 1);
+  }
+
+  inline
+  void
+  print_times(const index_set_t& frame,
+              const double loop_cpu_time,
+              const double sign_cpu_time,
+              const int nbr_mismatches)
+  {
+    const int index_width = 2;
+    cout << "Cl(" << setw(index_width) <<  max_pos(frame) << ","
+                  << setw(index_width) << -min_neg(frame) << ")"
+         << " CPU = ";
+    const ios::fmtflags& old_flags = cout.flags();
+    const streamsize width = 12;
+    const streamsize old_prec = cout.precision();
+    const streamsize new_prec = 3;
+    cout.setf(ios_base::fixed);
+    cout.setf(ios_base::showpoint);
+    cout << setprecision(new_prec)
+         << setw(width) << loop_cpu_time << " ms (loop) "
+         << setw(width) << sign_cpu_time << " (sign_of_mult) "
+         << setw(width) << loop_cpu_time / sign_cpu_time << " (ratio) "
+         << setprecision(old_prec)
+         << nbr_mismatches << " (mismatches)"
+         << endl;
+    cout.flags(old_flags);
+  }
+
+  /// Time nbr_sets * nbr_sets sign calculations using the loop and using sign_of_mult
+  static
+  void
+  time_sign(const index_set_t frame)
+  {
+    typedef random_generator<double> random_generator_t;
+    random_generator_t& generator = random_generator_t::generator();
+
+    // The value of the fold of an index set within the full frame is its bitset value
+    const index_set_t full_frame = index_set_t(make_pair(index_set_t::v_lo, index_set_t::v_hi));
+    vector<index_set_t> sets(nbr_sets);
+    vector<set_value_t> values(nbr_sets);
+    const index_t frm_end = frame.max()+1;
+    for (int
+        k = 0;
+        k != nbr_sets;
+        ++k)
+    {
+      for (index_t
+          idx = frame.min();
+          idx != frm_end;
+          ++idx)
+        if (frame[idx] && generator.uniform() < 0.5)
+          sets[k].set(idx);
+      values[k] = sets[k].value_of_fold(full_frame);
+    }
+
+    int nbr_mismatches = 0;
+    for (int
+        i = 0;
+        i != nbr_sets;
+        ++i)
+      for (int
+          k = 0;
+          k != nbr_sets;
+          ++k)
+        if (loop_sign_of_mult(values[i], values[k]) != sets[i].sign_of_mult(sets[k]))
+          ++nbr_mismatches;
+
+    int loop_sum = 0;
+    clock_t cpu_time = clock();
+      for (int
+          i = 0;
+          i != nbr_sets;
+          ++i)
+        for (int
+            k = 0;
+            k != nbr_sets;
+            ++k)
+          loop_sum += loop_sign_of_mult(values[i], values[k]);
+    const double loop_cpu_time = elapsed(cpu_time);
+
+    int sign_sum = 0;
+    cpu_time = clock();
+      for (int
+          i = 0;
+          i != nbr_sets;
+          ++i)
+        for (int
+            k = 0;
+            k != nbr_sets;
+            ++k)
+          sign_sum += sets[i].sign_of_mult(sets[k]);
+    const double sign_cpu_time = elapsed(cpu_time);
+
+    if (loop_sum != sign_sum)
+      ++nbr_mismatches;
+    print_times(frame, loop_cpu_time, sign_cpu_time, nbr_mismatches);
+  }
+
+  static
+  void
+  sign_test(const index_t n)
+  {
+    cout << "Sign of geometric product test:" << endl;
+    cout << "Index set pairs per frame: " << nbr_sets * nbr_sets << endl;
+
+    index_set_t frame = index_set_t();
+    for (index_t i = 1; i != n+1; ++i)
+    {
+      frame |= index_set_t((i % 2) ? (i+1)/2 : -(i/2));
+      time_sign(frame);
+    }
+  }
+}
+
+int sign_of_mult(const int n);
+
+#endif // GLUCAT_TEST_SIGN_OF_MULT_H
@@ -3,7 +3,7 @@ dir=${0%/*}
 if [ $# -gt 0 ]; then
  tests=$*;
 else
- tests='00 01 02 03 04 05 06 07 08 09 10 11 12 13 14 15 16';
+ tests='00 01 02 03 04 05 06 07 08 09 10 11 12 13 14 15 16 17';
 fi
 for i in ${tests}
 do
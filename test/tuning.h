@@ -53,6 +53,14 @@ const unsigned int Test_Tuning_Fast_Size_Threshold     = Test_Tuning_Max_Thresho
 const unsigned int Test_Tuning_Inv_Fast_Dim_Threshold  = Test_Tuning_Max_Threshold;
 const unsigned int Test_Tuning_Products_Size_Threshold = Test_Tuning_Max_Threshold;
 const precision_t  Test_Tuning_Function_Precision      = glucat::DEFAULT_Function_Precision;
+const unsigned int Test_Tuning_Dense_Mult_Matrix_Threshold = Test_Tuning_Max_Threshold;
+const unsigned int Test_Tuning_Grade_Index_Size_Threshold  = Test_Tuning_Max_Threshold;
+const unsigned int Test_Tuning_Mult_Threads_Size_Threshold = Test_Tuning_Max_Threshold;
+const unsigned int Test_Tuning_Mult_Table_Max_Count        =     0;
+const unsigned int Test_Tuning_Complex_Mult_Dim_Threshold  = Test_Tuning_Max_Threshold;
+const precision_t  Test_Tuning_Div_Factor_Precision       = glucat::DEFAULT_Div_Factor_Precision;
+const precision_t  Test_Tuning_Div_Residual_Precision     = glucat::DEFAULT_Div_Residual_Precision;
+const unsigned int Test_Tuning_Schur_Dim_Threshold        = Test_Tuning_Max_Threshold;
 #elif defined ( _GLUCAT_TEST_TUNING_NAIVE )
 const unsigned int Test_Tuning_Mult_Matrix_Threshold   =       0;
 __TEST_TUNING_DEFAULT_CONSTANT(Div_Max_Steps);
@@ -64,6 +72,14 @@ const unsigned int Test_Tuning_Fast_Size_Threshold     = Test_Tuning_Max_Thresho
 const unsigned int Test_Tuning_Inv_Fast_Dim_Threshold  = Test_Tuning_Max_Threshold;
 __TEST_TUNING_DEFAULT_CONSTANT(Products_Size_Threshold);
 const precision_t  Test_Tuning_Function_Precision      = glucat::DEFAULT_Function_Precision;
+const unsigned int Test_Tuning_Dense_Mult_Matrix_Threshold =     0;
+const unsigned int Test_Tuning_Grade_Index_Size_Threshold  = Test_Tuning_Max_Threshold;
+const unsigned int Test_Tuning_Mult_Threads_Size_Threshold = Test_Tuning_Max_Threshold;
+__TEST_TUNING_DEFAULT_CONSTANT(Mult_Table_Max_Count);
+const unsigned int Test_Tuning_Complex_Mult_Dim_Threshold  = Test_Tuning_Max_Threshold;
+const precision_t  Test_Tuning_Div_Factor_Precision       = glucat::DEFAULT_Div_Factor_Precision;
+const precision_t  Test_Tuning_Div_Residual_Precision     = glucat::DEFAULT_Div_Residual_Precision;
+const unsigned int Test_Tuning_Schur_Dim_Threshold        = Test_Tuning_Max_Threshold;
 #elif defined ( _GLUCAT_TEST_TUNING_FAST )
 const unsigned int Test_Tuning_Mult_Matrix_Threshold   =       0;
 const unsigned int Test_Tuning_Div_Max_Steps           =       0;
@@ -75,6 +91,14 @@ const unsigned int Test_Tuning_Fast_Size_Threshold     =       0;
 const unsigned int Test_Tuning_Inv_Fast_Dim_Threshold  =       0;
 const unsigned int Test_Tuning_Products_Size_Threshold =       0;
 const precision_t  Test_Tuning_Function_Precision      = glucat::DEFAULT_Function_Precision;
+const unsigned int Test_Tuning_Dense_Mult_Matrix_Threshold =     0;
+const unsigned int Test_Tuning_Grade_Index_Size_Threshold  =      0;
+const unsigned int Test_Tuning_Mult_Threads_Size_Threshold =      0;
+__TEST_TUNING_DEFAULT_CONSTANT(Mult_Table_Max_Count);
+const unsigned int Test_Tuning_Complex_Mult_Dim_Threshold  =      0;
+const precision_t  Test_Tuning_Div_Factor_Precision       = glucat::DEFAULT_Div_Factor_Precision;
+const precision_t  Test_Tuning_Div_Residual_Precision     = glucat::DEFAULT_Div_Residual_Precision;
+const unsigned int Test_Tuning_Schur_Dim_Threshold        =      0;
 #elif defined ( _GLUCAT_TEST_TUNING_PROMOTED )
 __TEST_TUNING_DEFAULT_CONSTANT(Mult_Matrix_Threshold);
 __TEST_TUNING_DEFAULT_CONSTANT(Div_Max_Steps);
@@ -86,6 +110,14 @@ __TEST_TUNING_DEFAULT_CONSTANT(Fast_Size_Threshold);
 __TEST_TUNING_DEFAULT_CONSTANT(Inv_Fast_Dim_Threshold);
 __TEST_TUNING_DEFAULT_CONSTANT(Products_Size_Threshold);
 const precision_t  Test_Tuning_Function_Precision      = glucat::precision_promoted;
+__TEST_TUNING_DEFAULT_CONSTANT(Dense_Mult_Matrix_Threshold);
+__TEST_TUNING_DEFAULT_CONSTANT(Grade_Index_Size_Threshold);
+__TEST_TUNING_DEFAULT_CONSTANT(Mult_Threads_Size_Threshold);
+__TEST_TUNING_DEFAULT_CONSTANT(Mult_Table_Max_Count);
+__TEST_TUNING_DEFAULT_CONSTANT(Complex_Mult_Dim_Threshold);
+const precision_t  Test_Tuning_Div_Factor_Precision       = glucat::DEFAULT_Div_Factor_Precision;
+const precision_t  Test_Tuning_Div_Residual_Precision     = glucat::precision_promoted;
+__TEST_TUNING_DEFAULT_CONSTANT(Schur_Dim_Threshold);
 #elif defined ( _GLUCAT_TEST_TUNING_DEMOTED )
 __TEST_TUNING_DEFAULT_CONSTANT(Mult_Matrix_Threshold);
 __TEST_TUNING_DEFAULT_CONSTANT(Div_Max_Steps);
@@ -97,6 +129,14 @@ __TEST_TUNING_DEFAULT_CONSTANT(Fast_Size_Threshold);
 __TEST_TUNING_DEFAULT_CONSTANT(Inv_Fast_Dim_Threshold);
 __TEST_TUNING_DEFAULT_CONSTANT(Products_Size_Threshold);
 const precision_t  Test_Tuning_Function_Precision      = glucat::precision_demoted;
+__TEST_TUNING_DEFAULT_CONSTANT(Dense_Mult_Matrix_Threshold);
+__TEST_TUNING_DEFAULT_CONSTANT(Grade_Index_Size_Threshold);
+__TEST_TUNING_DEFAULT_CONSTANT(Mult_Threads_Size_Threshold);
+__TEST_TUNING_DEFAULT_CONSTANT(Mult_Table_Max_Count);
+__TEST_TUNING_DEFAULT_CONSTANT(Complex_Mult_Dim_Threshold);
+const precision_t  Test_Tuning_Div_Factor_Precision       = glucat::precision_demoted;
+const precision_t  Test_Tuning_Div_Residual_Precision     = glucat::DEFAULT_Div_Residual_Precision;
+__TEST_TUNING_DEFAULT_CONSTANT(Schur_Dim_Threshold);
 #else
 __TEST_TUNING_DEFAULT_CONSTANT(Mult_Matrix_Threshold);
 __TEST_TUNING_DEFAULT_CONSTANT(Div_Max_Steps);
@@ -108,6 +148,14 @@ __TEST_TUNING_DEFAULT_CONSTANT(Fast_Size_Threshold);
 __TEST_TUNING_DEFAULT_CONSTANT(Inv_Fast_Dim_Threshold);
 __TEST_TUNING_DEFAULT_CONSTANT(Products_Size_Threshold);
 const precision_t  Test_Tuning_Function_Precision      = glucat::DEFAULT_Function_Precision;
+__TEST_TUNING_DEFAULT_CONSTANT(Dense_Mult_Matrix_Threshold);
+__TEST_TUNING_DEFAULT_CONSTANT(Grade_Index_Size_Threshold);
+__TEST_TUNING_DEFAULT_CONSTANT(Mult_Threads_Size_Threshold);
+__TEST_TUNING_DEFAULT_CONSTANT(Mult_Table_Max_Count);
+__TEST_TUNING_DEFAULT_CONSTANT(Complex_Mult_Dim_Threshold);
+const precision_t  Test_Tuning_Div_Factor_Precision       = glucat::DEFAULT_Div_Factor_Precision;
+const precision_t  Test_Tuning_Div_Residual_Precision     = glucat::DEFAULT_Div_Residual_Precision;
+__TEST_TUNING_DEFAULT_CONSTANT(Schur_Dim_Threshold);
 #endif
 
 /// Tuning policy
@@ -122,7 +170,15 @@ typedef glucat::tuning
     Test_Tuning_Fast_Size_Threshold,
     Test_Tuning_Inv_Fast_Dim_Threshold,
     Test_Tuning_Products_Size_Threshold,
-    Test_Tuning_Function_Precision
+    Test_Tuning_Function_Precision,
+    Test_Tuning_Dense_Mult_Matrix_Threshold,
+    Test_Tuning_Grade_Index_Size_Threshold,
+    Test_Tuning_Mult_Threads_Size_Threshold,
+    Test_Tuning_Mult_Table_Max_Count,
+    Test_Tuning_Complex_Mult_Dim_Threshold,
+    Test_Tuning_Div_Factor_Precision,
+    Test_Tuning_Div_Residual_Precision,
+    Test_Tuning_Schur_Dim_Threshold
   > Tune_P;
 
 #undef __TEST_TUNING_DEFAULT_CONSTANT
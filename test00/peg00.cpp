@@ -49,6 +49,9 @@ int test00()
   std::cout << std::endl << "matrix_multi<float,-4,4>" << std::endl;
   do_test00< matrix_multi<float,-4,4> >(4);
 
+  std::cout << std::endl << "vector_multi<float,-4,4>" << std::endl;
+  do_test00< vector_multi<float,-4,4> >(4);
+
   std::cout << std::endl << "framed_multi<float,-5,6>" << std::endl;
   do_test00< framed_multi<float,-5,6> >(5);
 
@@ -61,6 +64,9 @@ int test00()
   std::cout << std::endl << "matrix_multi<double>" << std::endl;
   do_test00< matrix_multi<double> >(5);
 
+  std::cout << std::endl << "vector_multi<double>" << std::endl;
+  do_test00< vector_multi<double> >(5);
+
   std::cout << std::endl << "framed_multi<long double>" << std::endl;
   do_test00< framed_multi<long double> >(5);
 
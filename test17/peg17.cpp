@@ -0,0 +1,134 @@
+/***************************************************************************
+    GluCat : Generic library of universal Clifford algebra templates
+    peg17.cpp : Driver for test 17
+                             -------------------
+    begin                : Sun 2026-10-18
+    copyright            : (C) 2001-2016 by Paul C. Leopardi
+ ***************************************************************************
+
+    This library is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published
+    by the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with this library.  If not, see <http://www.gnu.org/licenses/>.
+
+ ***************************************************************************
+ This library is based on a prototype written by Arvind Raja and was
+ licensed under the LGPL with permission of the author. See Arvind Raja,
+ "Object-oriented implementations of Clifford algebras in C++: a prototype",
+ in Ablamowicz, Lounesto and Parra (eds.)
+ "Clifford algebras with numeric and symbolic computations", Birkhauser, 1996.
+ ***************************************************************************
+     See also Arvind Raja's original header comments in glucat.h
+ ***************************************************************************/
+
+#include "test17/peg17.h"
+
+int test17()
+{
+  using namespace peg17;
+  cout << "Programming example 17 : Specialised products compared with framed_multi" << endl;
+  cout << endl;
+  cout << "fixed_multi<double,P,Q,-3,3>" << endl;
+  fixed_test<0,0>();
+  fixed_test<1,0>();
+  fixed_test<0,1>();
+  fixed_test<2,1>();
+  fixed_test<1,3>();
+  fixed_test<3,3>();
+  cout << endl;
+  cout << "batch_product<double,-3,3>" << endl;
+  batch_test(0, 0, 3);
+  batch_test(2, 1, 17);
+  batch_test(3, 3, 1000);
+  cout << endl;
+  cout << "framed_multi<double>: dense products" << endl;
+  table_test("{1}");
+  table_test("{-1,1,2}");
+  table_test("{-4,-2,3,5}");
+  table_test("{-7,-1,2,3,6,8}");
+  table_test("{-3,-2,-1,1,2,3,4}");
+  cout << endl;
+  cout << "framed_multi<double>: dense outer and inner products and left contraction" << endl;
+  dense_products_test("{-6,-5,-4,-3,-2,-1,1,2,3,4,5,6}", "{-6,-5,-4,-3,-2,-1,1,2,3,4,5,6}");
+  dense_products_test("{-5,-4,-3,-2,-1,1,2,3,4,5,6}", "{-6,-5,-4,-3,-2,-1,1,2,3,4,5,6}");
+  dense_products_test("{-6,-5,-4,-3,-2,-1,1,2,3,4,5,6}", "{-4,-3,-2,-1,1,2,3,4,5,6,7}");
+  cout << endl;
+  cout << "matrix::signed_perm" << endl;
+  signed_perm_test(1);
+  signed_perm_test(8);
+  signed_perm_test(64);
+  cout << endl;
+  cout << "matrix_multi<double>: basis elements from bounded caches" << endl;
+  basis_cache_test("{-2,-1,1,2,3}");
+  basis_cache_test("{-3,-1,2,4,5,7}");
+  cout << endl;
+  cout << "matrix::block_prod" << endl;
+  block_prod_test<ublas::row_major>(1, 1, 1);
+  block_prod_test<ublas::row_major>(64, 64, 64);
+  block_prod_test<ublas::row_major>(7, 300, 45);
+  block_prod_test<ublas::column_major>(64, 64, 64);
+  block_prod_test<ublas::column_major>(9, 257, 33);
+  cout << endl;
+#if defined(_GLUCAT_USE_LAPACK)
+  cout << "matrix::lapack_backend" << endl;
+  backend_test<double>(1);
+  backend_test<double>(37);
+  backend_test<double>(128);
+  backend_test<float>(37);
+  real_schur_test(16);
+  real_schur_test(64);
+  cout << endl;
+#endif
+  cout << "matrix::complex_prod" << endl;
+  complex_prod_test(2, 7u);
+  complex_prod_test(32, 8u);
+  complex_prod_test(64, 9u);
+  cout << endl;
+  cout << "matrix_multi<double>: products where p-q == 3 (mod 4)" << endl;
+  complex_mult_test("{-4,-3,-2,-1,1,2,3,4,5,6,7}");
+  complex_mult_test("{-8,-7,-6,-5,-4,-3,-2,-1,1,2,3}");
+  cout << endl;
+  cout << "divisor<double>" << endl;
+  divisor_test("{1}");
+  divisor_test("{-2,-1,1,2}");
+  divisor_test("{-3,-2,-1,1,2,3,4}");
+  divisor_test("{-4,-3,-2,-1,1,2,3,4,5,6}");
+  singular_divisor_test();
+  cout << endl;
+  cout << "matrix_multi<double>: quotients with the divisor factorized in float" << endl;
+  mixed_quotient_test("{-1,1}", 1.0);
+  mixed_quotient_test("{-3,-2,-1,1,2,3,4}", 1.0);
+  mixed_quotient_test("{-4,-3,-2,-1,1,2,3,4,5,6}", 1.0);
+  // Beyond the range of float, the divisor is factorized in double instead
+  mixed_quotient_test("{-3,-2,-1,1,2,3,4}", 1.0e60);
+  cout << endl;
+  cout << "framed_multi<double>: closed forms of exp and log" << endl;
+  closed_form_test("0.7{1}-0.3{2}");
+  closed_form_test("0.5{-1,1}");
+  closed_form_test("1.5{1,2,3}");
+  // Rotors turning by less than, and by more than pi/2
+  closed_form_test("0.5{1,2}");
+  closed_form_test("1.2{1,2}-0.4{1,3}");
+  closed_form_test("2{1,2}");
+  closed_form_test("3{1,3}+0.5{2,3}");
+  closed_form_test("0.4{1,2}+1.1{3,4}");
+  closed_form_test("2{1,2}+0.7{3,4}");
+  closed_form_test("2{1,2}+2.5{3,4}");
+  closed_form_test("0.3{1,2}+0.9{3,4}-0.2{4,5}");
+  closed_form_test("1.3{-1,2}");
+  cout << endl;
+  return 0;
+}
+
+using namespace glucat;
+
+int main(int argc, char ** argv)
+{ return control_t::control(argc, argv).call(test17); }
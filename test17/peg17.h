@@ -0,0 +1,705 @@
+#ifndef GLUCAT_TEST_PEG17_H
+#define GLUCAT_TEST_PEG17_H
+/***************************************************************************
+    GluCat : Generic library of universal Clifford algebra templates
+    peg17.h : programming example 17 : Specialised products compared with framed_multi
+                             -------------------
+    begin                : Sun 2026-10-18
+    copyright            : (C) 2001-2016 by Paul C. Leopardi
+ ***************************************************************************
+
+    This library is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published
+    by the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with this library.  If not, see <http://www.gnu.org/licenses/>.
+
+ ***************************************************************************
+ This library is based on a prototype written by Arvind Raja and was
+ licensed under the LGPL with permission of the author. See Arvind Raja,
+ "Object-oriented implementations of Clifford algebras in C++: a prototype",
+ in Ablamowicz, Lounesto and Parra (eds.)
+ "Clifford algebras with numeric and symbolic computations", Birkhauser, 1996.
+ ***************************************************************************
+     See also Arvind Raja's original header comments in glucat.h
+ ***************************************************************************/
+
+#include "glucat/glucat.h"
+#include "test/undefine.h"
+#define _GLUCAT_TEST_TUNING_DEMOTED
+#include "test/tuning.h"
+#include "glucat/glucat_imp.h"
+#include "test/try_catch.h"
+#include "test/control.h"
+
+namespace peg17
+{
+  using namespace glucat;
+  using namespace std;
+
+  /// Check that the result B of a specialised product is close to the result A from framed_multi
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  static
+  void
+  check(const framed_multi<Scalar_T,LO,HI>& A, const framed_multi<Scalar_T,LO,HI>& B, const string& msg)
+  {
+    static const Scalar_T scalar_eps = numeric_limits<Scalar_T>::epsilon();
+    const Scalar_T tol = scalar_eps *
+                         numeric_traits<Scalar_T>::pow(Scalar_T(2), numeric_limits<Scalar_T>::digits / 16 + 4);
+    const Scalar_T tol2 = tol * tol * Scalar_T(std::max(double(A.nbr_terms()), 1.0));
+    const bool relative = (norm(A) > tol2) && (norm(B) > tol2);
+    const Scalar_T abs_norm_diff = norm(A-B);
+    const Scalar_T norm_diff = (relative) ? abs_norm_diff/norm(A) : abs_norm_diff;
+    if (B.isnan() || norm_diff > tol2)
+    {
+      cout << "Test failed: " << msg << endl;
+      const streamsize prec = cout.precision(5);
+      cout << ((relative) ? "Relative" : "Absolute");
+      cout << " norm of difference == "
+           << numeric_traits<Scalar_T>::sqrt(norm_diff) << endl;
+      cout.precision(numeric_limits<Scalar_T>::digits10);
+      cout << "lhs==" << B << endl;
+      cout << "rhs==" << A << endl;
+      cout.precision(prec);
+    }
+  }
+
+  /// Check that the matrix B from a specialised kernel is close to the dense matrix A
+  template< typename Matrix_T >
+  static
+  void
+  check_matrix(const Matrix_T& A, const Matrix_T& B, const string& msg)
+  {
+    typedef typename Matrix_T::value_type Scalar_T;
+    static const Scalar_T scalar_eps = numeric_limits<Scalar_T>::epsilon();
+    const Scalar_T tol = scalar_eps *
+                         numeric_traits<Scalar_T>::pow(Scalar_T(2), numeric_limits<Scalar_T>::digits / 16 + 4);
+    const Scalar_T tol2 = tol * tol * Scalar_T(double(A.size1()));
+    const Scalar_T norm_A = matrix::norm_frob2(A);
+    const bool relative = (norm_A > tol2);
+    const Matrix_T diff = A - B;
+    const Scalar_T abs_norm_diff = matrix::norm_frob2(diff);
+    const Scalar_T norm_diff = (relative) ? abs_norm_diff/norm_A : abs_norm_diff;
+    if (A.size1() != B.size1() || A.size2() != B.size2() || matrix::isnan(B) || norm_diff > tol2)
+    {
+      cout << "Test failed: " << msg << endl;
+      const streamsize prec = cout.precision(5);
+      cout << ((relative) ? "Relative" : "Absolute");
+      cout << " norm of difference == "
+           << numeric_traits<Scalar_T>::sqrt(norm_diff) << endl;
+      cout.precision(prec);
+    }
+  }
+
+  /// Frame {-Q,...,-1,1,...,P}
+  template< typename Index_Set_T >
+  static
+  const Index_Set_T
+  signature_frame(const index_t p, const index_t q)
+  {
+    typedef typename Index_Set_T::index_pair_t index_pair_t;
+    Index_Set_T frm;
+    if (p != 0)
+      frm |= Index_Set_T(index_pair_t(1,p), true);
+    if (q != 0)
+      frm |= Index_Set_T(index_pair_t(-q,-1), true);
+    return frm;
+  }
+
+  /// Compare the products of fixed_multi<double,P,Q> with those of framed_multi
+  template< const index_t P, const index_t Q >
+  static
+  void
+  fixed_test()
+  {
+    typedef fixed_multi<double,P,Q,-3,3> fixed_t;
+    typedef typename fixed_t::framed_multi_t framed_t;
+    typedef typename fixed_t::index_set_t index_set_t;
+
+    const index_set_t frm = signature_frame<index_set_t>(P, Q);
+    for (int k = 0; k != 4; ++k)
+    {
+      const framed_t a = framed_t::random(frm);
+      const framed_t b = framed_t::random(frm);
+      const fixed_t fixed_a = fixed_t(a);
+      const fixed_t fixed_b = fixed_t(b);
+      check(a,     fixed_a.framed(),             "fixed_multi(a).framed() != a");
+      check(a * b, (fixed_a * fixed_b).framed(), "fixed_multi: a * b");
+      check(a ^ b, (fixed_a ^ fixed_b).framed(), "fixed_multi: a ^ b");
+      check(a & b, (fixed_a & fixed_b).framed(), "fixed_multi: a & b");
+      check(a % b, (fixed_a % fixed_b).framed(), "fixed_multi: a % b");
+    }
+  }
+
+  /// Compare the geometric products of batch_product<double> with those of framed_multi
+  static
+  void
+  batch_test(const index_t p, const index_t q, const size_t batch_size)
+  {
+    typedef batch_product<double,-3,3> batch_t;
+    typedef batch_t::framed_multi_t framed_t;
+    typedef batch_t::index_set_t index_set_t;
+
+    const index_set_t frm = signature_frame<index_set_t>(p, q);
+    const batch_t table(frm);
+    const size_t nbr_coords = table.dim() * batch_size;
+    vector<double> lhs(nbr_coords);
+    vector<double> rhs(nbr_coords);
+    vector<double> result(nbr_coords);
+    vector<framed_t> a(batch_size);
+    vector<framed_t> b(batch_size);
+    for (size_t i = 0; i != batch_size; ++i)
+    {
+      a[i] = framed_t::random(frm);
+      b[i] = framed_t::random(frm);
+      table.pack(a[i], &lhs[0], batch_size, i);
+      table.pack(b[i], &rhs[0], batch_size, i);
+    }
+    table.multiply(&lhs[0], &rhs[0], &result[0], batch_size);
+    for (size_t i = 0; i != batch_size; ++i)
+    {
+      check(a[i],        table.unpack(&lhs[0],    batch_size, i), "batch_product: unpack(pack(a)) != a");
+      check(a[i] * b[i], table.unpack(&result[0], batch_size, i), "batch_product: a * b");
+    }
+    // The result may overwrite the left hand side
+    table.multiply(&lhs[0], &rhs[0], &lhs[0], batch_size);
+    for (size_t i = 0; i != batch_size; ++i)
+      check(a[i] * b[i], table.unpack(&lhs[0], batch_size, i), "batch_product: a *= b");
+  }
+
+  /// Non-zero terms of a multivector, found by visiting each basis element of its frame
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  static
+  const vector< framed_multi<Scalar_T,LO,HI> >
+  terms_of(const framed_multi<Scalar_T,LO,HI>& val, const index_set<LO,HI> frm)
+  {
+    typedef framed_multi<Scalar_T,LO,HI> multivector_t;
+    typedef typename multivector_t::index_set_t index_set_t;
+
+    vector<multivector_t> result;
+    const set_value_t dim = set_value_t(1) << frm.count();
+    for (set_value_t stv = 0; stv != dim; ++stv)
+    {
+      const index_set_t ist = index_set_t(stv, frm, true);
+      if (val[ist] != Scalar_T(0))
+        result.push_back(multivector_t(ist, val[ist]));
+    }
+    return result;
+  }
+
+  /// Geometric product formed one pair of terms at a time
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  static
+  const framed_multi<Scalar_T,LO,HI>
+  termwise_product(const framed_multi<Scalar_T,LO,HI>& lhs, const framed_multi<Scalar_T,LO,HI>& rhs)
+  {
+    typedef framed_multi<Scalar_T,LO,HI> multivector_t;
+    typedef typename multivector_t::index_set_t index_set_t;
+
+    const index_set_t frm = lhs.frame() | rhs.frame();
+    const vector<multivector_t> lhs_terms = terms_of(lhs, frm);
+    const vector<multivector_t> rhs_terms = terms_of(rhs, frm);
+    multivector_t result;
+    for (size_t j = 0; j != lhs_terms.size(); ++j)
+      for (size_t k = 0; k != rhs_terms.size(); ++k)
+        result += lhs_terms[j] * rhs_terms[k];
+    return result;
+  }
+
+  /// Compare the dense geometric product of framed_multi<double> with the product of its terms
+  static
+  void
+  table_test(const string& frm_str)
+  {
+    typedef framed_multi<double> framed_t;
+    typedef framed_t::index_set_t index_set_t;
+
+    const index_set_t frm = index_set_t(frm_str);
+    for (int k = 0; k != 4; ++k)
+    {
+      const framed_t a = framed_t::random(frm);
+      const framed_t b = framed_t::random(frm);
+      check(termwise_product(a, b), a * b, "framed_multi: a * b in " + frm_str);
+    }
+  }
+
+  /// Products <a(r) * b(s)>(k) summed over the grades r and s of the operands, where k is
+  /// r+s for the outer product, |r-s| for the inner product, and s-r for the left contraction
+  template< typename Scalar_T, const index_t LO, const index_t HI >
+  static
+  void
+  graded_products(const framed_multi<Scalar_T,LO,HI>& lhs, const framed_multi<Scalar_T,LO,HI>& rhs,
+                  framed_multi<Scalar_T,LO,HI>& outer,
+                  framed_multi<Scalar_T,LO,HI>& inner,
+                  framed_multi<Scalar_T,LO,HI>& left_contraction)
+  {
+    typedef framed_multi<Scalar_T,LO,HI> multivector_t;
+
+    const index_t max_grade = (lhs.frame() | rhs.frame()).count();
+    outer = Scalar_T(0);
+    inner = Scalar_T(0);
+    left_contraction = Scalar_T(0);
+    for (index_t r = 0; r <= max_grade; ++r)
+      for (index_t s = 0; s <= max_grade; ++s)
+      {
+        const multivector_t& prod = lhs(r) * rhs(s);
+        if (r + s <= max_grade)
+          outer += prod(r + s);
+        if (r != 0 && s != 0)
+          inner += prod(std::abs(r - s));
+        if (r <= s)
+          left_contraction += prod(s - r);
+      }
+  }
+
+  /// Compare the dense kernels of the outer and inner products and left contraction of
+  /// framed_multi<double> with sums of grades of geometric products
+  static
+  void
+  dense_products_test(const string& lhs_frm_str, const string& rhs_frm_str)
+  {
+    typedef framed_multi<double> framed_t;
+    typedef framed_t::index_set_t index_set_t;
+
+    const framed_t a = framed_t::random(index_set_t(lhs_frm_str));
+    const framed_t b = framed_t::random(index_set_t(rhs_frm_str));
+    if (double(a.nbr_terms()) * double(b.nbr_terms()) <= double(Tune_P::products_size_threshold))
+      cout << "Test failed: products of " << lhs_frm_str << " and " << rhs_frm_str
+           << " do not use the dense kernels" << endl;
+    framed_t outer;
+    framed_t inner;
+    framed_t left_contraction;
+    graded_products(a, b, outer, inner, left_contraction);
+    const string msg = " in " + lhs_frm_str + " and " + rhs_frm_str;
+    check(outer,            a ^ b, "framed_multi: a ^ b" + msg);
+    check(inner,            a & b, "framed_multi: a & b" + msg);
+    check(left_contraction, a % b, "framed_multi: a % b" + msg);
+  }
+
+  /// Dense matrix of the given size, filled with entries which depend on seed
+  template< typename Matrix_T >
+  static
+  const Matrix_T
+  filled(const size_t nbr_rows, const size_t nbr_cols, const unsigned int seed)
+  {
+    Matrix_T result(nbr_rows, nbr_cols);
+    for (size_t row = 0; row != nbr_rows; ++row)
+      for (size_t col = 0; col != nbr_cols; ++col)
+        result(row, col) = double(int((row * 37 + col * 11 + seed) % 17) - 8) / 8.0;
+    return result;
+  }
+
+  /// Dense matrix with the entries of a signed permutation matrix
+  static
+  const ublas::matrix<double>
+  dense(const matrix::signed_perm& perm)
+  {
+    typedef matrix::signed_perm::size_type size_type;
+    const size_type dim = perm.size();
+    ublas::matrix<double> result(dim, dim);
+    result.clear();
+    for (size_type row = 0; row != dim; ++row)
+      result(row, perm.col(row)) = perm.sign(row);
+    return result;
+  }
+
+  /// Signed permutation matrix of dimension dim, shuffled according to seed
+  static
+  const matrix::signed_perm
+  shuffled_perm(const matrix::signed_perm::size_type dim, const unsigned int seed)
+  {
+    typedef matrix::signed_perm::size_type size_type;
+    vector<size_type> packed(dim);
+    for (size_type row = 0; row != dim; ++row)
+      packed[row] = row;
+    for (size_type row = dim; row > 1; --row)
+      swap(packed[row - 1], packed[(row * 2654435761u + seed) % row]);
+    for (size_type row = 0; row != dim; ++row)
+      if (((row * 40503u + seed) >> 3) & 1)
+        packed[row] |= matrix::signed_perm::packed_sign_bit;
+    return matrix::signed_perm(dim, &packed[0]);
+  }
+
+  /// Compare the kernels of signed_perm with dense matrix arithmetic
+  static
+  void
+  signed_perm_test(const matrix::signed_perm::size_type dim)
+  {
+    typedef matrix::signed_perm signed_perm;
+    typedef signed_perm::size_type size_type;
+    typedef ublas::matrix<double> matrix_t;
+
+    const signed_perm lhs = shuffled_perm(dim, 12345u);
+    const signed_perm rhs = shuffled_perm(dim, 67890u);
+    const matrix_t dense_lhs = dense(lhs);
+    const matrix_t dense_rhs = dense(rhs);
+
+    check_matrix(dense_lhs, dense(signed_perm(dense_lhs)), "signed_perm(dense(P)) != P");
+    vector<size_type> packed(dim);
+    lhs.pack(&packed[0]);
+    check_matrix(dense_lhs, dense(signed_perm(dim, &packed[0])), "signed_perm: unpacked pack(P) != P");
+
+    const matrix_t dense_prod = ublas::prod(dense_lhs, dense_rhs);
+    check_matrix(dense_prod, dense(matrix::signed_perm_prod(lhs, rhs)), "signed_perm_prod(P, Q)");
+
+    const matrix_t val = filled<matrix_t>(dim, dim, 0);
+    const double crd = -1.25;
+    matrix_t sum = val;
+    matrix::signed_perm_plus_assign(sum, lhs, crd);
+    check_matrix(matrix_t(val + crd * dense_lhs), sum, "signed_perm_plus_assign(X, P, c)");
+
+    const double dense_inner = matrix::inner<double>(dense_lhs, val);
+    const double perm_inner  = matrix::signed_perm_inner<double>(lhs, val);
+    if (abs(dense_inner - perm_inner) > 64 * numeric_limits<double>::epsilon() * max(abs(dense_inner), 1.0))
+    {
+      cout << "Test failed: signed_perm_inner(P, X)" << endl;
+      cout << "lhs==" << perm_inner << endl;
+      cout << "rhs==" << dense_inner << endl;
+    }
+  }
+
+  /// Compare products of basis elements of matrix_multi<double> with framed_multi,
+  /// with budgets for the caches of basis elements and generators small enough to force eviction
+  static
+  void
+  basis_cache_test(const string& frm_str)
+  {
+    typedef matrix_multi<double> matrix_t;
+    typedef matrix_t::framed_multi_t framed_t;
+    typedef matrix_t::index_set_t index_set_t;
+
+    const size_t tiny_budget = 4096;
+    matrix_t::set_basis_cache_max_bytes(tiny_budget);
+    matrix_t::set_generator_cache_max_bytes(tiny_budget);
+    const size_t basis_evictions = matrix_t::basis_cache_stats().evictions;
+
+    const index_set_t frm = index_set_t(frm_str);
+    const set_value_t dim = set_value_t(1) << frm.count();
+    for (set_value_t lhs_stv = 0; lhs_stv != dim; ++lhs_stv)
+    {
+      const framed_t lhs = framed_t(index_set_t(lhs_stv, frm, true));
+      for (set_value_t rhs_stv = 0; rhs_stv < dim; rhs_stv += 3)
+      {
+        const framed_t rhs = framed_t(index_set_t(rhs_stv, frm, true));
+        check(lhs * rhs, framed_t(matrix_t(lhs, frm) * matrix_t(rhs, frm)),
+              "matrix_multi: e_S * e_T in " + frm_str);
+      }
+    }
+    const framed_t a = framed_t::random(frm);
+    const framed_t b = framed_t::random(frm);
+    check(a * b, framed_t(matrix_t(a, frm) * matrix_t(b, frm)), "matrix_multi: a * b in " + frm_str);
+    if (matrix_t::basis_cache_stats().evictions == basis_evictions)
+      cout << "Test failed: no basis elements were evicted in " << frm_str << endl;
+
+    matrix_t::set_basis_cache_max_bytes(DEFAULT_Basis_Cache_Max_Bytes);
+    matrix_t::set_generator_cache_max_bytes(DEFAULT_Generator_Cache_Max_Bytes);
+  }
+
+  /// Compare the cache blocked product of dense matrices with ublas::prod
+  template< typename Orientation_T >
+  static
+  void
+  block_prod_test(const size_t nbr_rows, const size_t depth, const size_t nbr_cols)
+  {
+    typedef ublas::matrix<double, Orientation_T> matrix_t;
+
+    const matrix_t lhs = filled<matrix_t>(nbr_rows, depth, 1);
+    const matrix_t rhs = filled<matrix_t>(depth, nbr_cols, 2);
+    const matrix_t acc = filled<matrix_t>(nbr_rows, nbr_cols, 3);
+    const matrix_t dense_prod = ublas::prod(lhs, rhs);
+
+    matrix_t result = acc;
+    matrix::block_prod(lhs, rhs, result, true);
+    check_matrix(dense_prod, result, "block_prod(A, B, C, true)");
+    result = acc;
+    matrix::block_prod(lhs, rhs, result, false);
+    check_matrix(matrix_t(acc + dense_prod), result, "block_prod(A, B, C, false)");
+  }
+
+#if defined(_GLUCAT_USE_LAPACK)
+  /// Compare the LAPACK backend with the uBLAS backend
+  template< typename Scalar_T >
+  static
+  void
+  backend_test(const size_t dim)
+  {
+    typedef ublas::matrix<Scalar_T> matrix_t;
+    typedef matrix::ublas_backend  ublas_t;
+    typedef matrix::lapack_backend lapack_t;
+
+    const matrix_t lhs = filled<matrix_t>(dim, dim, 4);
+    const matrix_t rhs = filled<matrix_t>(dim, dim, 5);
+
+    // Products, assigned and accumulated
+    for (int init = 1; init >= 0; --init)
+    {
+      matrix_t ublas_prod = rhs;
+      matrix_t lapack_prod = rhs;
+      ublas_t::prod(lhs, rhs, ublas_prod, init != 0);
+      lapack_t::prod(lhs, rhs, lapack_prod, init != 0);
+      check_matrix(ublas_prod, lapack_prod, string("lapack_backend::prod, init == ") + (init ? "true" : "false"));
+    }
+
+    // Solution of a non-singular system via LU factorization
+    const matrix_t a = lhs + Scalar_T(double(dim)) * ublas::identity_matrix<Scalar_T>(dim);
+    matrix_t ublas_lu = a;
+    matrix_t lapack_lu = a;
+    typename ublas_t::pivot_t ublas_pivots(dim);
+    typename lapack_t::pivot_t lapack_pivots(dim);
+    const size_t ublas_singular = ublas_t::lu_factorize(ublas_lu, ublas_pivots);
+    const size_t lapack_singular = lapack_t::lu_factorize(lapack_lu, lapack_pivots);
+    if (ublas_singular != 0 || lapack_singular != 0)
+      cout << "Test failed: lu_factorize found a zero pivot" << endl;
+    else
+    {
+      matrix_t ublas_x = rhs;
+      matrix_t lapack_x = rhs;
+      ublas_t::lu_substitute(ublas_lu, ublas_pivots, ublas_x);
+      lapack_t::lu_substitute(lapack_lu, lapack_pivots, lapack_x);
+      check_matrix(ublas_x, lapack_x, "lapack_backend::lu_substitute");
+      check_matrix(rhs, matrix_t(ublas::prod(a, lapack_x)), "a * lapack_backend::lu_substitute(a, b) != b");
+    }
+
+    check_matrix(matrix_t(1, 1, ublas_t::norm_inf(lhs)), matrix_t(1, 1, lapack_t::norm_inf(lhs)),
+                 "lapack_backend::norm_inf");
+    check_matrix(matrix_t(1, 1, ublas_t::norm_frob2(lhs)), matrix_t(1, 1, lapack_t::norm_frob2(lhs)),
+                 "lapack_backend::norm_frob2");
+  }
+
+  /// Compare the real Schur decompositions of the LAPACK and uBLAS backends
+  static
+  void
+  real_schur_test(const size_t dim)
+  {
+    typedef ublas::matrix<double> matrix_t;
+
+    const matrix_t a = filled<matrix_t>(dim, dim, 6);
+    matrix_t ublas_t = a;
+    matrix_t lapack_t = a;
+    matrix_t ublas_q;
+    matrix_t lapack_q;
+    if (!matrix::ublas_backend::real_schur(ublas_t, ublas_q)
+     || !matrix::lapack_backend::real_schur(lapack_t, lapack_q))
+    {
+      cout << "Test failed: real_schur did not converge" << endl;
+      return;
+    }
+    const matrix_t ublas_qt = ublas::prod(ublas_q, ublas_t);
+    const matrix_t lapack_qt = ublas::prod(lapack_q, lapack_t);
+    check_matrix(a, matrix_t(ublas::prod(ublas_qt, ublas::trans(ublas_q))),
+                 "ublas_backend::real_schur: q * t * trans(q) != a");
+    check_matrix(a, matrix_t(ublas::prod(lapack_qt, ublas::trans(lapack_q))),
+                 "lapack_backend::real_schur: q * t * trans(q) != a");
+    // The Schur forms may differ in the order of their blocks, but have the same trace and norm
+    double ublas_trace = 0.0;
+    double lapack_trace = 0.0;
+    for (size_t k = 0; k != dim; ++k)
+    {
+      ublas_trace += ublas_t(k, k);
+      lapack_trace += lapack_t(k, k);
+    }
+    const double trace_tol = 256.0 * double(dim) * numeric_limits<double>::epsilon() *
+                             std::sqrt(matrix::norm_frob2(a));
+    if (abs(ublas_trace - lapack_trace) > trace_tol)
+    {
+      cout << "Test failed: real_schur: traces of t differ" << endl;
+      cout << "lhs==" << lapack_trace << endl;
+      cout << "rhs==" << ublas_trace << endl;
+    }
+    check_matrix(matrix_t(1, 1, matrix::norm_frob2(ublas_t)), matrix_t(1, 1, matrix::norm_frob2(lapack_t)),
+                 "real_schur: norms of t differ");
+  }
+#endif
+
+  /// Compare complex_prod with ublas::prod, for matrices which commute with a unit imaginary
+  static
+  void
+  complex_prod_test(const matrix::signed_perm::size_type dim, const unsigned int seed)
+  {
+    typedef matrix::signed_perm signed_perm;
+    typedef signed_perm::size_type size_type;
+    typedef ublas::matrix<double> matrix_t;
+
+    // unit_i == perm * [0 -1; 1 0] * trans(perm), where perm is a signed permutation matrix
+    const size_type half_dim = dim / 2;
+    const matrix_t a = filled<matrix_t>(half_dim, half_dim, seed);
+    const matrix_t b = filled<matrix_t>(half_dim, half_dim, seed + 1);
+    const matrix_t c = filled<matrix_t>(half_dim, half_dim, seed + 2);
+    const matrix_t d = filled<matrix_t>(half_dim, half_dim, seed + 3);
+    matrix_t i_block(dim, dim);
+    matrix_t lhs_block(dim, dim);
+    matrix_t rhs_block(dim, dim);
+    i_block.clear();
+    for (size_type j = 0; j != half_dim; ++j)
+    {
+      i_block(j, j + half_dim) = -1.0;
+      i_block(j + half_dim, j) =  1.0;
+      for (size_type k = 0; k != half_dim; ++k)
+      {
+        lhs_block(j, k)                       =  a(j, k);
+        lhs_block(j, k + half_dim)            = -b(j, k);
+        lhs_block(j + half_dim, k)            =  b(j, k);
+        lhs_block(j + half_dim, k + half_dim) =  a(j, k);
+        rhs_block(j, k)                       =  c(j, k);
+        rhs_block(j, k + half_dim)            = -d(j, k);
+        rhs_block(j + half_dim, k)            =  d(j, k);
+        rhs_block(j + half_dim, k + half_dim) =  c(j, k);
+      }
+    }
+    const matrix_t perm = dense(shuffled_perm(dim, seed));
+    const matrix_t perm_i = ublas::prod(perm, i_block);
+    const matrix_t perm_lhs = ublas::prod(perm, lhs_block);
+    const matrix_t perm_rhs = ublas::prod(perm, rhs_block);
+    const signed_perm unit_i = signed_perm(matrix_t(ublas::prod(perm_i, ublas::trans(perm))));
+    const matrix_t lhs = ublas::prod(perm_lhs, ublas::trans(perm));
+    const matrix_t rhs = ublas::prod(perm_rhs, ublas::trans(perm));
+
+    matrix_t result;
+    matrix::complex_prod(lhs, rhs, unit_i, result);
+    check_matrix(matrix_t(ublas::prod(lhs, rhs)), result, "complex_prod(A, B, unit_i)");
+  }
+
+  /// Compare the product of matrix_multi<double> with the product of terms, where p-q == 3 (mod 4)
+  static
+  void
+  complex_mult_test(const string& frm_str)
+  {
+    typedef matrix_multi<double> matrix_t;
+    typedef matrix_t::framed_multi_t framed_t;
+    typedef matrix_t::index_set_t index_set_t;
+
+    const index_set_t frm = index_set_t(frm_str);
+    for (int k = 0; k != 2; ++k)
+    {
+      // Sparse values keep the product of terms cheap, while the matrices stay dense
+      const framed_t a = framed_t::random(frm, 1.0/64.0);
+      const framed_t b = framed_t::random(frm, 1.0/64.0);
+      check(termwise_product(a, b), framed_t(matrix_t(a, frm) * matrix_t(b, frm)),
+            "matrix_multi: a * b in " + frm_str);
+    }
+  }
+
+  /// Compare the quotients of divisor<double> with operator/ and inv() of matrix_multi<double>
+  static
+  void
+  divisor_test(const string& frm_str)
+  {
+    typedef matrix_multi<double> matrix_t;
+    typedef matrix_t::framed_multi_t framed_t;
+    typedef matrix_t::index_set_t index_set_t;
+
+    const index_set_t frm = index_set_t(frm_str);
+    const matrix_t b = matrix_t(framed_t::random(frm), frm);
+    const divisor<double> d(b);
+    if (d.is_singular())
+    {
+      cout << "Test failed: divisor is singular in " << frm_str << endl;
+      return;
+    }
+    check(framed_t(inv(b)), framed_t(d.inv()), "divisor: inv() in " + frm_str);
+
+    vector<matrix_t> lhs;
+    for (int k = 0; k != 4; ++k)
+    {
+      const matrix_t a = matrix_t(framed_t::random(frm), frm);
+      lhs.push_back(a);
+      check(framed_t(a / b), framed_t(a / d),         "divisor: a / d in " + frm_str);
+      check(framed_t(a / b), framed_t(d.quotient(a)), "divisor: quotient(a) in " + frm_str);
+    }
+    vector<matrix_t> result;
+    d.quotient(lhs, result);
+    for (size_t k = 0; k != lhs.size(); ++k)
+      check(framed_t(lhs[k] / b), framed_t(result[k]), "divisor: batch quotient in " + frm_str);
+
+    // A numerator outside the frame of the divisor
+    const index_t outside = frm.max() + 1;
+    const matrix_t a = matrix_t(framed_t::random(frm | index_set_t(outside)));
+    check(framed_t(a / b), framed_t(a / d), "divisor: a / d, a outside the frame, in " + frm_str);
+  }
+
+  /// Check that a singular divisor gives NaN quotients
+  static
+  void
+  singular_divisor_test()
+  {
+    typedef matrix_multi<double> matrix_t;
+
+    const divisor<double> d(matrix_t("1+{1}"));
+    if (!d.is_singular())
+      cout << "Test failed: divisor(1+{1}) is not singular" << endl;
+    if (!(matrix_t("{1,2}") / d).isnan())
+      cout << "Test failed: {1,2} / divisor(1+{1}) is not NaN" << endl;
+  }
+
+  /// Compare quotients of matrix_multi<double>, whose divisor is factorized in float,
+  /// with quotients of matrix_multi<long double>, rounded to double
+  static
+  void
+  mixed_quotient_test(const string& frm_str, const double scale)
+  {
+    typedef matrix_multi<double> matrix_t;
+    typedef matrix_t::framed_multi_t framed_t;
+    typedef matrix_t::index_set_t index_set_t;
+    typedef matrix_multi<long double> long_matrix_t;
+    typedef long_matrix_t::framed_multi_t long_framed_t;
+
+    const index_set_t frm = index_set_t(frm_str);
+    const framed_t b = framed_t::random(frm) * scale;
+    const matrix_t matrix_b = matrix_t(b, frm);
+    const long_matrix_t long_b = long_matrix_t(long_framed_t(b), frm);
+    const divisor<double> d(matrix_b);
+    for (int k = 0; k != 4; ++k)
+    {
+      const framed_t a = framed_t::random(frm) * scale;
+      const matrix_t matrix_a = matrix_t(a, frm);
+      const framed_t reference = framed_t(long_framed_t(long_matrix_t(long_framed_t(a), frm) / long_b));
+      check(reference, framed_t(matrix_a / matrix_b), "mixed precision: a / b in " + frm_str);
+      check(reference, framed_t(matrix_a / d),        "mixed precision: a / divisor(b) in " + frm_str);
+    }
+    check(framed_t(long_framed_t(inv(long_b))), framed_t(inv(matrix_b)), "mixed precision: inv(b) in " + frm_str);
+  }
+
+  /// Compare the closed forms of exp and log with the general algorithms, for val and exp(val)
+  // The general log is taken in long double, since the demoted tuning factorizes divisors in float.
+  // If the scalar part of exp(val) is not negative, the closed form of log must apply.
+  static
+  void
+  closed_form_test(const string& val_str)
+  {
+    typedef framed_multi<double> framed_t;
+    typedef framed_multi<long double> long_framed_t;
+    typedef long_framed_t::matrix_multi_t long_matrix_t;
+
+    const framed_t val = framed_t(val_str);
+    framed_t R;
+    if (!closed_form_exp(val, R))
+    {
+      cout << "Test failed: closed_form_exp does not apply to " << val_str << endl;
+      return;
+    }
+    check(clifford_exp(val), R, "closed_form_exp(" + val_str + ")");
+
+    const long_framed_t long_R = long_framed_t(R);
+    const framed_t general_log =
+      framed_t(long_framed_t(matrix_log(long_matrix_t(long_R), long_matrix_t(complexifier(long_R)))));
+    framed_t closed_log;
+    if (closed_form_log(R, closed_log))
+    {
+      check(general_log, closed_log, "closed_form_log(exp(" + val_str + "))");
+      check(R, clifford_exp(closed_log), "exp(closed_form_log(exp(" + val_str + ")))");
+    }
+    else if (scalar(R) >= 0.0)
+      cout << "Test failed: closed_form_log does not apply to exp(" << val_str << ")" << endl;
+  }
+}
+
+int test17();
+
+#endif